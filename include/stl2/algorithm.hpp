@@ -18,6 +18,7 @@
 #include <stl2/detail/algorithm/adjacent_find.hpp>
 #include <stl2/detail/algorithm/all_of.hpp>
 #include <stl2/detail/algorithm/any_of.hpp>
+#include <stl2/detail/algorithm/apply_permutation.hpp>
 #include <stl2/detail/algorithm/binary_search.hpp>
 #include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/algorithm/copy_backward.hpp>
@@ -25,6 +26,7 @@
 #include <stl2/detail/algorithm/copy_n.hpp>
 #include <stl2/detail/algorithm/count.hpp>
 #include <stl2/detail/algorithm/count_if.hpp>
+#include <stl2/detail/algorithm/counting_sort.hpp>
 #include <stl2/detail/algorithm/equal.hpp>
 #include <stl2/detail/algorithm/equal_range.hpp>
 #include <stl2/detail/algorithm/fill.hpp>
@@ -37,6 +39,10 @@
 #include <stl2/detail/algorithm/for_each.hpp>
 #include <stl2/detail/algorithm/generate.hpp>
 #include <stl2/detail/algorithm/generate_n.hpp>
+#include <stl2/detail/algorithm/hash_difference.hpp>
+#include <stl2/detail/algorithm/hash_intersection.hpp>
+#include <stl2/detail/algorithm/hash_unique.hpp>
+#include <stl2/detail/algorithm/histogram.hpp>
 #include <stl2/detail/algorithm/includes.hpp>
 #include <stl2/detail/algorithm/inplace_merge.hpp>
 #include <stl2/detail/algorithm/is_heap.hpp>
@@ -51,6 +57,7 @@
 #include <stl2/detail/algorithm/max.hpp>
 #include <stl2/detail/algorithm/max_element.hpp>
 #include <stl2/detail/algorithm/merge.hpp>
+#include <stl2/detail/algorithm/merge_k.hpp>
 #include <stl2/detail/algorithm/min.hpp>
 #include <stl2/detail/algorithm/min_element.hpp>
 #include <stl2/detail/algorithm/minmax.hpp>
@@ -58,6 +65,7 @@
 #include <stl2/detail/algorithm/mismatch.hpp>
 #include <stl2/detail/algorithm/move.hpp>
 #include <stl2/detail/algorithm/move_backward.hpp>
+#include <stl2/detail/algorithm/network_sort.hpp>
 #include <stl2/detail/algorithm/next_permutation.hpp>
 #include <stl2/detail/algorithm/none_of.hpp>
 #include <stl2/detail/algorithm/nth_element.hpp>
@@ -89,7 +97,9 @@
 #include <stl2/detail/algorithm/set_union.hpp>
 #include <stl2/detail/algorithm/shuffle.hpp>
 #include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/sort_by_cached_key.hpp>
 #include <stl2/detail/algorithm/sort_heap.hpp>
+#include <stl2/detail/algorithm/sort_indices.hpp>
 #include <stl2/detail/algorithm/stable_partition.hpp>
 #include <stl2/detail/algorithm/stable_sort.hpp>
 #include <stl2/detail/algorithm/swap_ranges.hpp>
@@ -97,5 +107,6 @@
 #include <stl2/detail/algorithm/unique.hpp>
 #include <stl2/detail/algorithm/unique_copy.hpp>
 #include <stl2/detail/algorithm/upper_bound.hpp>
+#include <stl2/detail/algorithm/weighted_sample.hpp>
 
 #endif
@@ -14,6 +14,7 @@
 #define STL2_DETAIL_ALGORITHM_ADJACENT_FIND_HPP
 
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/concepts.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
@@ -26,19 +27,26 @@ STL2_OPEN_NAMESPACE {
 			IndirectRelation<projected<I, Proj>> Pred = equal_to>
 		constexpr I
 		operator()(I first, S last, Pred pred = {}, Proj proj = {}) const {
-			if (first == last) {
-				return first;
-			}
-
-			auto next = first;
-			for (; ++next != last; first = next) {
-				if (__stl2::invoke(pred,
-						__stl2::invoke(proj, *first),
-						__stl2::invoke(proj, *next))) {
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				return ext::rewrap(std::move(first), ufirst,
+					(*this)(ufirst, std::move(ulast), __stl2::ref(pred),
+						__stl2::ref(proj)));
+			} else {
+				if (first == last) {
 					return first;
 				}
+
+				auto next = first;
+				for (; ++next != last; first = next) {
+					if (__stl2::invoke(pred,
+							__stl2::invoke(proj, *first),
+							__stl2::invoke(proj, *next))) {
+						return first;
+					}
+				}
+				return next;
 			}
-			return next;
 		}
 
 		template<ForwardRange R, class Proj = identity,
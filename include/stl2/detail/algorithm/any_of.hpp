@@ -15,6 +15,7 @@
 #define STL2_DETAIL_ALGORITHM_ANY_OF_HPP
 
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/concepts.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -25,12 +26,18 @@ STL2_OPEN_NAMESPACE {
 		template<InputIterator I, Sentinel<I> S, class Proj = identity,
 			IndirectUnaryPredicate<projected<I, Proj>> Pred>
 		constexpr bool operator()(I first, S last, Pred pred, Proj proj = {}) const {
-			for (; first != last; ++first) {
-				if (__stl2::invoke(pred, __stl2::invoke(proj, *first))) {
-					return true;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(std::move(first), std::move(last));
+				return (*this)(std::move(ufirst), std::move(ulast), __stl2::ref(pred),
+					__stl2::ref(proj));
+			} else {
+				for (; first != last; ++first) {
+					if (__stl2::invoke(pred, __stl2::invoke(proj, *first))) {
+						return true;
+					}
 				}
+				return false;
 			}
-			return false;
 		}
 
 		template<InputRange R, class Proj = identity,
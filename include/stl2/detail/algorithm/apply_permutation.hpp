@@ -0,0 +1,88 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_APPLY_PERMUTATION_HPP
+#define STL2_DETAIL_ALGORITHM_APPLY_PERMUTATION_HPP
+
+#include <tuple>
+#include <type_traits>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/primitives.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// apply_permutation [Extension]
+// Rearrange each of the ranges rs... in place so that the element at
+// position i is the one that was at position perm[i] - the gather order
+// returned by sort_indices - moving every element once. The permutation
+// is walked one cycle at a time, holding a single element of each range
+// aside while the cycle is rotated, so the extra storage is one value per
+// range regardless of the size of the permutation. Visited entries of perm
+// are marked by complementing them and restored before returning, so perm
+// must be mutable but is unchanged afterwards.
+//
+// Preconditions: perm is a permutation of [0, n) where n is the size of
+// perm, and each of rs... has at least n elements.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __apply_permutation_fn : private __niebloid {
+			template<RandomAccessRange P, RandomAccessRange... Rs>
+			requires
+				std::is_integral_v<iter_value_t<iterator_t<P>>> &&
+				std::is_signed_v<iter_value_t<iterator_t<P>>> &&
+				Writable<iterator_t<P>, iter_value_t<iterator_t<P>>> &&
+				(Permutable<iterator_t<Rs>> && ...)
+			void operator()(P&& perm, Rs&&... rs) const {
+				using D = iter_value_t<iterator_t<P>>;
+				auto p = __stl2::begin(perm);
+				const auto n = static_cast<D>(__stl2::distance(perm));
+				STL2_EXPECT(((__stl2::distance(rs) >= n) && ...));
+				if (n < 2 || sizeof...(Rs) == 0) return;
+
+				auto run = [&](auto... firsts) {
+					const auto marked = [n](D x) { return x < 0 || x >= n; };
+					for (D i = 0; i < n; ++i) {
+						D j = p[i];
+						if (marked(j)) continue;
+						p[i] = ~j;
+						if (j == i) continue;
+						std::tuple<iter_value_t<decltype(firsts)>...> tmp{
+							__stl2::iter_move(firsts + i)...};
+						D k = i;
+						do {
+							STL2_EXPECT(!marked(j));
+							((*(firsts + k) = __stl2::iter_move(firsts + j)), ...);
+							k = j;
+							j = p[k];
+							p[k] = ~j;
+						} while (j != i);
+						std::apply([&](auto&... t) {
+							((*(firsts + k) = std::move(t)), ...);
+						}, tmp);
+					}
+					for (D i = 0; i < n; ++i) {
+						p[i] = ~p[i];
+					}
+				};
+				run(__stl2::begin(rs)...);
+			}
+		};
+
+		inline constexpr __apply_permutation_fn apply_permutation {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,202 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_BLOCK_SHUFFLE_HPP
+#define STL2_DETAIL_ALGORITHM_BLOCK_SHUFFLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stl2/random.hpp>
+#include <stl2/detail/construct_destruct.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/parallel_for.hpp>
+#include <stl2/detail/randutils.hpp>
+#include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/algorithm/shuffle.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/primitives.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// block_shuffle [Extension]
+// shuffle for ranges much larger than the cache, where each swap of
+// Fisher-Yates is a cache miss. Each element is sent to one of several
+// blocks, chosen uniformly and independently, each block small enough
+// to stay in cache, and the blocks are then shuffled in place one after
+// another. Since the blocks' contents are independent uniform draws and
+// each block's order is uniform, so is the permutation. Sending the
+// elements costs a pass over the range to count each block's elements
+// and a pass to move them to a buffer, both sequential but for one write
+// stream per block.
+//
+// With threads > 1 (0 meaning one per hardware thread) the passes are
+// split among that many workers, each with its own ext::xoshiro256pp -
+// seeded once from g and jumped 2^128 numbers apart. g defaults to the
+// thread's engine, which is seeded from a random_device by
+// detail::random::seeder. With threads == 1 the blocks are sorted out
+// on the calling thread.
+//
+// Ranges that fit in a few blocks, elements that may throw when moved,
+// and failure to allocate the buffer of n elements all fall back to
+// shuffle.
+//
+// Since it starts threads, block_shuffle is not included by
+// <stl2/algorithm.hpp>; include this header, and link with the threads
+// library, to use it.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Draws 32-bit words from any generator for a SeedSequence.
+		template<class G>
+		struct __generator_seq {
+			G& g;
+
+			template<class I>
+			void generate(I first, I last) {
+				std::uniform_int_distribution<std::uint32_t> word{};
+				for (; first != last; ++first) *first = word(g);
+			}
+		};
+
+		template<class I>
+		META_CONCEPT __block_shufflable =
+			std::is_nothrow_constructible_v<iter_value_t<I>, iter_rvalue_reference_t<I>> &&
+			std::is_nothrow_assignable_v<iter_reference_t<I>, iter_value_t<I>> &&
+			std::is_nothrow_destructible_v<iter_value_t<I>>;
+
+		// Shuffle the n elements at first through buf, big enough for n, by
+		// way of blocks.
+		template<RandomAccessIterator I>
+		requires Permutable<I> && __block_shufflable<I>
+		void __block_shuffle(I first, iter_difference_t<I> n, iter_value_t<I>* buf,
+			std::size_t blocks, unsigned workers, ext::xoshiro256pp engine)
+		{
+			using D = iter_difference_t<I>;
+			std::vector<ext::xoshiro256pp> engines;
+			engines.reserve(workers);
+			for (unsigned w = 0; w < workers; ++w) {
+				engines.push_back(engine);
+				engine.jump();
+			}
+			// Worker w takes [part(w), part(w + 1)) of the input, and of the
+			// blocks.
+			auto part = [workers](auto total, unsigned w) {
+				return static_cast<decltype(total)>(total / workers * w +
+					std::min<decltype(total)>(w, total % workers));
+			};
+			auto block = [blocks](ext::xoshiro256pp& e) {
+				return __bounded_random(e, blocks);
+			};
+
+			// Count first, replaying the same draws for the scatter.
+			std::vector<D> counts(workers * blocks);
+			__parallel_for(workers, [&](unsigned w) {
+				auto e = engines[w];
+				D* const count = counts.data() + w * blocks;
+				for (D i = part(n, w), end = part(n, w + 1); i < end; ++i) {
+					++count[block(e)];
+				}
+			});
+			// Block b fills [start[b], start[b + 1]) of the output, the
+			// elements from each worker after those from the workers before.
+			std::vector<D> start(blocks + 1);
+			D sum = 0;
+			for (std::size_t b = 0; b < blocks; ++b) {
+				start[b] = sum;
+				for (unsigned w = 0; w < workers; ++w) {
+					sum += std::exchange(counts[w * blocks + b], sum);
+				}
+			}
+			start[blocks] = sum;
+
+			__parallel_for(workers, [&](unsigned w) {
+				auto& e = engines[w];
+				D* const next = counts.data() + w * blocks;
+				for (D i = part(n, w), end = part(n, w + 1); i < end; ++i) {
+					detail::construct(buf[next[block(e)]++],
+						__stl2::iter_move(first + i));
+				}
+			});
+			__parallel_for(workers, [&](unsigned w) {
+				auto& e = engines[w];
+				for (std::size_t b = part(blocks, w), end = part(blocks, w + 1);
+					b < end; ++b)
+				{
+					for (D i = start[b]; i < start[b + 1]; ++i) {
+						*(first + i) = std::move(buf[i]);
+						detail::destruct(buf[i]);
+					}
+					__stl2::shuffle(first + start[b], first + start[b + 1], e);
+				}
+			});
+		}
+	}
+
+	namespace ext {
+		struct __block_shuffle_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S,
+				class Gen = detail::default_random_engine&>
+			requires Permutable<I> &&
+				UniformRandomBitGenerator<std::remove_reference_t<Gen>>
+			I operator()(I first, S sent, Gen&& g = detail::get_random_engine(),
+				unsigned threads = 1) const
+			{
+				auto last = __stl2::next(first, std::move(sent));
+				if constexpr (detail::__block_shufflable<I>) {
+					using V = iter_value_t<I>;
+					const auto n = last - first;
+					if (threads == 0) {
+						threads = std::max(std::thread::hardware_concurrency(), 1u);
+					}
+					std::size_t blocks = static_cast<std::size_t>(n) * sizeof(V) / block_bytes;
+					if (blocks >= 4) {
+						blocks = std::clamp<std::size_t>(blocks,
+							std::min<std::size_t>(threads, max_blocks), max_blocks);
+						detail::temporary_buffer<V> buf{n};
+						if (buf.size() >= n) {
+							detail::__generator_seq<std::remove_reference_t<Gen>> seq{g};
+							detail::__block_shuffle(first, n, buf.data(), blocks,
+								static_cast<unsigned>(std::min<std::size_t>(threads, blocks)),
+								xoshiro256pp{seq});
+							return last;
+						}
+					}
+				}
+				return __stl2::shuffle(first, last, g);
+			}
+
+			template<RandomAccessRange R, class Gen = detail::default_random_engine&>
+			requires Permutable<iterator_t<R>> &&
+				UniformRandomBitGenerator<std::remove_reference_t<Gen>>
+			safe_iterator_t<R> operator()(R&& r, Gen&& g = detail::get_random_engine(),
+				unsigned threads = 1) const
+			{
+				return (*this)(__stl2::begin(r), __stl2::end(r), g, threads);
+			}
+
+		private:
+			// A block about the size of a core's L2 cache, and a bound on
+			// the write streams of the scatter, past which TLB misses cost
+			// more than larger blocks do.
+			static constexpr std::size_t block_bytes = 1024 * 1024;
+			static constexpr std::size_t max_blocks = 256;
+		};
+
+		inline constexpr __block_shuffle_fn block_shuffle {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
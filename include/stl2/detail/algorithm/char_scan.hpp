@@ -0,0 +1,122 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_CHAR_SCAN_HPP
+#define STL2_DETAIL_ALGORITHM_CHAR_SCAN_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// Character class scans
+// The kernels of find_if and count_if over contiguous ranges of
+// characters tested by an ext::char_set, and of find_first_of over
+// characters compared by equal_to, which first gathers the characters it
+// seeks into a char_set. With AVX2, 32 characters are tested at a time:
+// a byte shuffle indexed by the low nibbles of the characters selects
+// from the set's table the byte of bits for each, and a second shuffle
+// indexed by the high nibbles the bit within it.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class I, class S>
+		META_CONCEPT __char_scannable = std::is_pointer_v<I> && Same<I, S> &&
+			(Same<iter_reference_t<I>, iter_value_t<I>&> ||
+			 Same<iter_reference_t<I>, const iter_value_t<I>&>) &&
+			__char_like<iter_value_t<I>>;
+
+		template<class Pred, class Proj>
+		META_CONCEPT __char_set_predicate =
+			__same_function_object<Pred, ext::char_set> &&
+			__same_function_object<Proj, identity>;
+
+#if defined(__AVX2__)
+		class __simd_char_set {
+		public:
+			explicit __simd_char_set(const ext::char_set& set) noexcept
+			: low_{_mm256_broadcastsi128_si256(_mm_load_si128(
+				reinterpret_cast<const __m128i*>(set.rows_[0])))}
+			, high_{_mm256_broadcastsi128_si256(_mm_load_si128(
+				reinterpret_cast<const __m128i*>(set.rows_[1])))}
+			{}
+
+			// One bit per character of the 32 at p, set for the members.
+			template<class T>
+			unsigned operator()(const T* const p) const noexcept {
+				const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+				const __m256i nibble = _mm256_set1_epi8(0x0f);
+				const __m256i lo = _mm256_and_si256(x, nibble);
+				const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble);
+				// The sign bit of each character picks its row.
+				const __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(low_, lo),
+					_mm256_shuffle_epi8(high_, lo), x);
+				const __m256i bit = _mm256_shuffle_epi8(_mm256_setr_epi8(
+					1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+					1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128), hi);
+				return static_cast<unsigned>(_mm256_movemask_epi8(
+					_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit)));
+			}
+
+		private:
+			__m256i low_;
+			__m256i high_;
+		};
+#endif // __AVX2__
+
+		// The first member of set in [first, last), or last.
+		template<class T>
+		const T* __find_char_set(const T* first, const T* const last,
+			const ext::char_set& set) noexcept
+		{
+#if defined(__AVX2__)
+			if (last - first >= 32) {
+				const __simd_char_set members{set};
+				for (; last - first >= 32; first += 32) {
+					if (const unsigned m = members(first)) {
+						return first + __builtin_ctz(m);
+					}
+				}
+			}
+#endif
+			for (; first != last && !set(*first); ++first);
+			return first;
+		}
+
+		// The number of members of set in [first, last).
+		template<class T>
+		std::ptrdiff_t __count_char_set(const T* first, const T* const last,
+			const ext::char_set& set) noexcept
+		{
+			std::ptrdiff_t n = 0;
+#if defined(__AVX2__)
+			if (last - first >= 32) {
+				const __simd_char_set members{set};
+				for (; last - first >= 32; first += 32) {
+					n += __builtin_popcount(members(first));
+				}
+			}
+#endif
+			for (; first != last; ++first) {
+				n += set(*first);
+			}
+			return n;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,330 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_COMPRESS_HPP
+#define STL2_DETAIL_ALGORITHM_COMPRESS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// Stream compaction
+// The kernels of remove_if, copy_if and partition_copy over contiguous
+// ranges of small trivially copyable values. Each element is copied to
+// the output unconditionally and the output advanced by the predicate's
+// result, so that no branch depends on the data. With AVX2, predicates
+// ext::compare_to<Comp, T> - ext::lt(v) and the like - on elements of
+// the 4- and 8-byte arithmetic type T are tested a vector at a time, and
+// the elements that pass moved to the front of the vector by a permute
+// from a table indexed by the mask of results.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class I, class S>
+		META_CONCEPT __compressible = std::is_pointer_v<I> && Same<I, S> &&
+			(Same<iter_reference_t<I>, iter_value_t<I>&> ||
+			 Same<iter_reference_t<I>, const iter_value_t<I>&>) &&
+			std::is_trivially_copyable_v<iter_value_t<I>> &&
+			sizeof(iter_value_t<I>) <= 2 * sizeof(void*);
+
+		// Elements per chunk staged on the stack by __compress_copy.
+		inline constexpr std::ptrdiff_t __compress_chunk = 256;
+
+		// __compress_copy tests a chunk of elements before it writes any of
+		// them, which cannot be told from the sequential algorithm only if
+		// neither the predicate nor the projection can throw.
+		template<class Ref, class Pred, class Proj>
+		META_CONCEPT __nothrow_compress_predicate =
+			std::is_nothrow_invocable_v<Proj&, Ref> &&
+			std::is_nothrow_invocable_v<Pred&, std::invoke_result_t<Proj&, Ref>>;
+
+#if defined(__AVX2__)
+		template<class T>
+		META_CONCEPT __simd_compress_element =
+			(std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)) ||
+			Same<T, float> || Same<T, double>;
+
+
+		template<class T, class P>
+		constexpr bool __simd_compress_predicate = false;
+		template<class T, class Comp>
+		constexpr bool __simd_compress_predicate<T, ext::compare_to<Comp, T>> =
+			__simd_compress_element<T> && __builtin_comparison<Comp>;
+
+		// For each mask of the lanes of a vector of Lanes elements, the
+		// indices of the 32-bit words of the masked lanes, in order, one
+		// per byte.
+		template<std::size_t Lanes>
+		constexpr auto __make_compress_table() {
+			std::array<std::uint64_t, std::size_t{1} << Lanes> table{};
+			constexpr std::size_t words = 8 / Lanes;
+			for (std::size_t m = 0; m < table.size(); ++m) {
+				std::size_t n = 0;
+				for (std::size_t lane = 0; lane < Lanes; ++lane) {
+					if (!(m >> lane & 1)) continue;
+					for (std::size_t w = 0; w < words; ++w, ++n) {
+						table[m] |= std::uint64_t{lane * words + w} << (8 * n);
+					}
+				}
+			}
+			return table;
+		}
+
+		template<std::size_t Lanes>
+		inline constexpr auto __compress_table = __make_compress_table<Lanes>();
+
+		template<class T>
+		inline __m256i __simd_broadcast(T value) noexcept {
+			if constexpr (sizeof(T) == 4) {
+				std::int32_t x;
+				std::memcpy(&x, &value, sizeof(T));
+				return _mm256_set1_epi32(x);
+			} else {
+				long long x;
+				std::memcpy(&x, &value, sizeof(T));
+				return _mm256_set1_epi64x(x);
+			}
+		}
+
+		// All ones in the lanes x where Comp{}(x, v).
+		template<class T, class Comp>
+		inline __m256i __simd_compare(__m256i x, __m256i v) noexcept {
+			if constexpr (std::is_floating_point_v<T>) {
+				// Ordered comparisons but for !=, which NaN satisfies.
+				constexpr int op =
+					Same<Comp, less> ? _CMP_LT_OQ :
+					Same<Comp, greater> ? _CMP_GT_OQ :
+					Same<Comp, less_equal> ? _CMP_LE_OQ :
+					Same<Comp, greater_equal> ? _CMP_GE_OQ :
+					Same<Comp, equal_to> ? _CMP_EQ_OQ : _CMP_NEQ_UQ;
+				if constexpr (sizeof(T) == 4) {
+					return _mm256_castps_si256(_mm256_cmp_ps(
+						_mm256_castsi256_ps(x), _mm256_castsi256_ps(v), op));
+				} else {
+					return _mm256_castpd_si256(_mm256_cmp_pd(
+						_mm256_castsi256_pd(x), _mm256_castsi256_pd(v), op));
+				}
+			} else {
+				if constexpr (std::is_unsigned_v<T>) {
+					// Unsigned order is signed order with the sign bits flipped.
+					const __m256i sign = __simd_broadcast(
+						std::numeric_limits<std::make_signed_t<T>>::min());
+					x = _mm256_xor_si256(x, sign);
+					v = _mm256_xor_si256(v, sign);
+				}
+				auto gt = [](__m256i a, __m256i b) {
+					if constexpr (sizeof(T) == 4) return _mm256_cmpgt_epi32(a, b);
+					else return _mm256_cmpgt_epi64(a, b);
+				};
+				auto eq = [](__m256i a, __m256i b) {
+					if constexpr (sizeof(T) == 4) return _mm256_cmpeq_epi32(a, b);
+					else return _mm256_cmpeq_epi64(a, b);
+				};
+				const __m256i ones = _mm256_set1_epi32(-1);
+				if constexpr (Same<Comp, less>) return gt(v, x);
+				else if constexpr (Same<Comp, greater>) return gt(x, v);
+				else if constexpr (Same<Comp, less_equal>) return _mm256_xor_si256(gt(x, v), ones);
+				else if constexpr (Same<Comp, greater_equal>) return _mm256_xor_si256(gt(v, x), ones);
+				else if constexpr (Same<Comp, equal_to>) return eq(x, v);
+				else return _mm256_xor_si256(eq(x, v), ones);
+			}
+		}
+
+		template<class T>
+		inline unsigned __simd_movemask(__m256i m) noexcept {
+			if constexpr (sizeof(T) == 4) {
+				return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+			} else {
+				return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(m)));
+			}
+		}
+
+		// Store the first n lanes of x at out, and nothing past them.
+		template<class T>
+		inline void __simd_store_first(T* out, __m256i x, int n) noexcept {
+			if constexpr (sizeof(T) == 4) {
+				const __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(n),
+					_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+				_mm256_maskstore_epi32(reinterpret_cast<int*>(out), mask, x);
+			} else {
+				const __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(n),
+					_mm256_setr_epi64x(0, 1, 2, 3));
+				_mm256_maskstore_epi64(reinterpret_cast<long long*>(out), mask, x);
+			}
+		}
+
+		// The lanes of x in mask m, moved to the front.
+		template<class T>
+		inline __m256i __simd_compress_lanes(__m256i x, unsigned m) noexcept {
+			const auto words = static_cast<long long>(__compress_table<32 / sizeof(T)>[m]);
+			return _mm256_permutevar8x32_epi32(x,
+				_mm256_cvtepu8_epi32(_mm_cvtsi64_si128(words)));
+		}
+
+		// Compress the whole vectors at the start of [first, last),
+		// advancing first past them. Each vector is stored in full at the
+		// output, which may trail first - or, if Exact, only the lanes
+		// that pass, so that nothing is written past the result.
+		template<bool True, bool False, bool Exact = false, class T, class Comp>
+		void __simd_compress(const T*& first, const T* const last, T*& out_true,
+			T*& out_false, const ext::compare_to<Comp, T>& pred) noexcept
+		{
+			constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+			constexpr unsigned all = (1u << lanes) - 1;
+			const __m256i v = __simd_broadcast(pred.value);
+			for (; last - first >= lanes; first += lanes) {
+				const __m256i x =
+					_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+				const unsigned m = __simd_movemask<T>(__simd_compare<T, Comp>(x, v));
+				const int n = __builtin_popcount(m);
+				if constexpr (True) {
+					const __m256i y = __simd_compress_lanes<T>(x, m);
+					if constexpr (Exact) {
+						__simd_store_first(out_true, y, n);
+					} else {
+						_mm256_storeu_si256(reinterpret_cast<__m256i*>(out_true), y);
+					}
+					out_true += n;
+				}
+				if constexpr (False) {
+					const __m256i y = __simd_compress_lanes<T>(x, ~m & all);
+					if constexpr (Exact) {
+						__simd_store_first(out_false, y, lanes - n);
+					} else {
+						_mm256_storeu_si256(reinterpret_cast<__m256i*>(out_false), y);
+					}
+					out_false += lanes - n;
+				}
+			}
+		}
+#endif // __AVX2__
+
+		// Copy the elements of [first, last) that satisfy pred by proj to
+		// out_true if True, and the others to out_false if False,
+		// advancing each output past the elements copied. Each output must
+		// have room for last - first elements, or trail first. Ref is the
+		// reference type through which pred and proj see the elements.
+		template<class Ref, bool True, bool False, class T, class Pred, class Proj>
+		void __compress(const T* first, const T* const last, T*& out_true,
+			T*& out_false, Pred& pred, Proj& proj)
+		{
+#if defined(__AVX2__)
+			using P = __uncvref<__unwrap<Pred>>;
+			if constexpr (__simd_compress_predicate<T, P> &&
+				__same_function_object<Proj, identity>)
+			{
+				__simd_compress<True, False>(first, last, out_true, out_false,
+					static_cast<const P&>(pred));
+			}
+#endif
+			for (; first != last; ++first) {
+				const bool keep = __stl2::invoke(pred,
+					__stl2::invoke(proj, static_cast<Ref>(*const_cast<T*>(first))));
+				// memmove: the output may be first itself, or raw storage.
+				if constexpr (True) {
+					std::memmove(out_true, first, sizeof(T));
+					out_true += keep;
+				}
+				if constexpr (False) {
+					std::memmove(out_false, first, sizeof(T));
+					out_false += !keep;
+				}
+			}
+		}
+
+#if defined(__AVX2__)
+		// Can __compress_copy write the vectors of the elements that pass
+		// straight to its outputs?
+		template<class T, class O1, class O2, bool True, bool False,
+			class Pred, class Proj>
+		META_CONCEPT __compress_direct =
+			__simd_compress_predicate<T, __uncvref<__unwrap<Pred>>> &&
+			__same_function_object<Proj, identity> &&
+			(!True || Same<O1, T*>) && (!False || Same<O2, T*>);
+#else
+		template<class T, class O1, class O2, bool True, bool False,
+			class Pred, class Proj>
+		META_CONCEPT __compress_direct = false;
+#endif
+
+		// __compress to arbitrary outputs, which need only have room for
+		// the result. Pointer outputs are written directly when the
+		// comparisons are vectorized, storing only the lanes that pass;
+		// otherwise the elements are compressed in chunks staged on the
+		// stack, and copied out.
+		template<class Ref, bool True, bool False, class T, class O1, class O2,
+			class Pred, class Proj>
+		requires __nothrow_compress_predicate<Ref, Pred, Proj>
+		void __compress_copy(const T* first, const T* const last, O1& out_true,
+			O2& out_false, Pred& pred, Proj& proj)
+		{
+			if constexpr (__compress_direct<T, O1, O2, True, False, Pred, Proj>) {
+#if defined(__AVX2__)
+				using P = __uncvref<__unwrap<Pred>>;
+				const auto& p = static_cast<const P&>(pred);
+				if constexpr (True && False) {
+					__simd_compress<true, true, true>(first, last, out_true,
+						out_false, p);
+				} else if constexpr (True) {
+					T* none = nullptr;
+					__simd_compress<true, false, true>(first, last, out_true,
+						none, p);
+				} else {
+					T* none = nullptr;
+					__simd_compress<false, true, true>(first, last, none,
+						out_false, p);
+				}
+				for (; first != last; ++first) {
+					if (p(*first)) {
+						if constexpr (True) *out_true++ = *first;
+					} else {
+						if constexpr (False) *out_false++ = *first;
+					}
+				}
+#endif
+			} else {
+				// Uninitialized, so that T need not be default constructible:
+				// __compress's memmove creates the elements it writes.
+				alignas(T) unsigned char staged_true[sizeof(T) * (True ? __compress_chunk : 1)];
+				alignas(T) unsigned char staged_false[sizeof(T) * (False ? __compress_chunk : 1)];
+				auto flush = [](T* p, T* const end, auto& out) {
+					for (; p != end; ++p, ++out) *out = static_cast<Ref>(*p);
+				};
+				while (first != last) {
+					const T* const end = first +
+						(last - first < __compress_chunk ? last - first : __compress_chunk);
+					T* const true_begin = reinterpret_cast<T*>(staged_true);
+					T* const false_begin = reinterpret_cast<T*>(staged_false);
+					T* t = true_begin;
+					T* f = false_begin;
+					__compress<Ref, True, False>(first, end, t, f, pred, proj);
+					if constexpr (True) flush(true_begin, t, out_true);
+					if constexpr (False) flush(false_begin, f, out_false);
+					first = end;
+				}
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
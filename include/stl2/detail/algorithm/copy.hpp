@@ -13,6 +13,8 @@
 #define STL2_DETAIL_ALGORITHM_COPY_HPP
 
 #include <stl2/detail/algorithm/results.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/concepts.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
@@ -28,10 +30,23 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectlyCopyable<I, O>
 		constexpr copy_result<I, O>
 		operator()(I first, S last, O result) const {
-			for (; first != last; (void) ++first, (void) ++result) {
-				*result = *first;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				auto [uend, out] = (*this)(ufirst, std::move(ulast), std::move(result));
+				return {ext::rewrap(std::move(first), ufirst, std::move(uend)),
+					std::move(out)};
+			} else if constexpr (ext::SegmentedSentinel<S, I>) {
+				auto end = detail::segmented_walk(std::move(first), last,
+					[&](auto lfirst, const auto& llast) {
+						result = (*this)(std::move(lfirst), llast, std::move(result)).out;
+					});
+				return {std::move(end), std::move(result)};
+			} else {
+				for (; first != last; (void) ++first, (void) ++result) {
+					*result = *first;
+				}
+				return {std::move(first), std::move(result)};
 			}
-			return {std::move(first), std::move(result)};
 		}
 
 		template<InputRange R, WeaklyIncrementable O>
@@ -50,10 +65,24 @@ STL2_OPEN_NAMESPACE {
 			requires IndirectlyCopyable<I, O>
 			constexpr copy_result<I, O>
 			operator()(I first, S last, O result) const {
-				for (; first != last; (void) ++first, (void) ++result) {
-					*result = *first;
+				if constexpr (ext::Unwrappable<I, S>) {
+					auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+					auto [uend, out] = (*this)(ufirst, std::move(ulast), std::move(result));
+					return {ext::rewrap(std::move(first), ufirst, std::move(uend)),
+						std::move(out)};
+				} else if constexpr (ext::SegmentedSentinel<S, I>) {
+					auto end = detail::segmented_walk(std::move(first), last,
+						[&](auto lfirst, const auto& llast) {
+							result = (*this)(std::move(lfirst), llast,
+								std::move(result)).out;
+						});
+					return {std::move(end), std::move(result)};
+				} else {
+					for (; first != last; (void) ++first, (void) ++result) {
+						*result = *first;
+					}
+					return {std::move(first), std::move(result)};
 				}
-				return {std::move(first), std::move(result)};
 			}
 
 			template<InputRange R, class O>
@@ -13,13 +13,17 @@
 #ifndef STL2_DETAIL_ALGORITHM_COPY_IF_HPP
 #define STL2_DETAIL_ALGORITHM_COPY_IF_HPP
 
+#include <stl2/detail/algorithm/compress.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/concepts.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // copy_if [alg.copy]
+// Contiguous ranges of small trivially copyable values are compacted
+// without branching on the predicate; see compress.hpp.
 //
 STL2_OPEN_NAMESPACE {
 	template<class I, class O>
@@ -31,15 +35,34 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectlyCopyable<I, O>
 		constexpr copy_if_result<I, O>
 		operator()(I first, S last, O result, Pred pred, Proj proj = {}) const {
-			for (; first != last; ++first) {
-				iter_reference_t<I>&& v = *first;
-				if (__stl2::invoke(pred, __stl2::invoke(proj, v))) {
-					*result = std::forward<iter_reference_t<I>>(v);
-					++result;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				auto [upos, out] = (*this)(ufirst, std::move(ulast),
+					std::move(result), __stl2::ref(pred), __stl2::ref(proj));
+				return {ext::rewrap(std::move(first), ufirst, std::move(upos)),
+					std::move(out)};
+			} else {
+				if constexpr (detail::__compressible<I, S> &&
+					detail::__nothrow_compress_predicate<iter_reference_t<I>,
+						Pred, Proj>)
+				{
+					if (!detail::__is_constant_evaluated()) {
+						int none = 0;
+						detail::__compress_copy<iter_reference_t<I>, true, false>(
+							first, last, result, none, pred, proj);
+						return {std::move(last), std::move(result)};
+					}
+				}
+				for (; first != last; ++first) {
+					iter_reference_t<I>&& v = *first;
+					if (__stl2::invoke(pred, __stl2::invoke(proj, v))) {
+						*result = std::forward<iter_reference_t<I>>(v);
+						++result;
+					}
 				}
-			}
 
-			return {std::move(first), std::move(result)};
+				return {std::move(first), std::move(result)};
+			}
 		}
 
 		template<InputRange R, WeaklyIncrementable O, class Proj = identity,
@@ -13,6 +13,8 @@
 #define STL2_DETAIL_ALGORITHM_COUNT_HPP
 
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/concepts.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -24,13 +26,26 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectRelation<equal_to, projected<I, Proj>, const T*>
 		constexpr iter_difference_t<I>
 		operator()(I first, S last, const T& value, Proj proj = {}) const {
-			iter_difference_t<I> n = 0;
-			for (; first != last; ++first) {
-				if (__stl2::invoke(proj, *first) == value) {
-					++n;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(std::move(first), std::move(last));
+				return static_cast<iter_difference_t<I>>((*this)(std::move(ufirst),
+					std::move(ulast), value, __stl2::ref(proj)));
+			} else if constexpr (ext::SegmentedSentinel<S, I>) {
+				iter_difference_t<I> n = 0;
+				detail::segmented_walk(std::move(first), last,
+					[&](auto lfirst, const auto& llast) {
+						n += (*this)(std::move(lfirst), llast, value, __stl2::ref(proj));
+					});
+				return n;
+			} else {
+				iter_difference_t<I> n = 0;
+				for (; first != last; ++first) {
+					if (__stl2::invoke(proj, *first) == value) {
+						++n;
+					}
 				}
+				return n;
 			}
-			return n;
 		}
 
 		template<InputRange R, class T, class Proj = identity>
@@ -12,7 +12,10 @@
 #ifndef STL2_DETAIL_ALGORITHM_COUNT_IF_HPP
 #define STL2_DETAIL_ALGORITHM_COUNT_IF_HPP
 
+#include <stl2/detail/algorithm/char_scan.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/concepts.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -24,13 +27,35 @@ STL2_OPEN_NAMESPACE {
 			IndirectUnaryPredicate<projected<I, Proj>> Pred>
 		constexpr iter_difference_t<I>
 		operator()(I first, S last, Pred pred, Proj proj = {}) const {
-			auto n = iter_difference_t<I>{0};
-			for (; first != last; ++first) {
-				if (__stl2::invoke(pred, __stl2::invoke(proj, *first))) {
-					++n;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(std::move(first), std::move(last));
+				return static_cast<iter_difference_t<I>>((*this)(std::move(ufirst),
+					std::move(ulast), __stl2::ref(pred), __stl2::ref(proj)));
+			} else if constexpr (ext::SegmentedSentinel<S, I>) {
+				auto n = iter_difference_t<I>{0};
+				detail::segmented_walk(std::move(first), last,
+					[&](auto lfirst, const auto& llast) {
+						n += (*this)(std::move(lfirst), llast, __stl2::ref(pred),
+							__stl2::ref(proj));
+					});
+				return n;
+			} else {
+				if constexpr (detail::__char_scannable<I, S> &&
+					detail::__char_set_predicate<Pred, Proj>)
+				{
+					if (!detail::__is_constant_evaluated()) {
+						return detail::__count_char_set(first, last,
+							static_cast<const ext::char_set&>(pred));
+					}
 				}
+				auto n = iter_difference_t<I>{0};
+				for (; first != last; ++first) {
+					if (__stl2::invoke(pred, __stl2::invoke(proj, *first))) {
+						++n;
+					}
+				}
+				return n;
 			}
-			return n;
 		}
 
 		template<InputRange R, class Proj = identity,
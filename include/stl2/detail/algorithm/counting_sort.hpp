@@ -0,0 +1,77 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_COUNTING_SORT_HPP
+#define STL2_DETAIL_ALGORITHM_COUNTING_SORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/counting_sort_n.hpp>
+#include <stl2/detail/algorithm/histogram.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/primitives.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// counting_sort [Extension]
+// Stably sort [first, last) by small integer keys: the projections of the
+// elements, which must be integers or enumerators in [0, bound). The keys
+// are counted with histogram, the counts summed into the position of
+// each key's first element, and the elements moved out to a temporary
+// buffer and back to their positions - O(n + bound) with no comparisons.
+// Each element's key is recorded as it is counted, so the projection is
+// called once per element, on the range's references. Temporary buffers
+// take n elements, n keys and the counts; if they are not available, the
+// range is stable_sorted by key instead, projecting on every comparison.
+//
+// sort and stable_sort use counting_sort when the projected key is an
+// integer or enumeration of at most 16 bits, the comparison is less or
+// greater, and the range is long enough to repay counting every possible
+// key.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __counting_sort_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Proj = identity>
+			requires Permutable<I> &&
+				detail::__histogram_key<__uncvref<indirect_result_t<Proj&, I>>>
+			I operator()(I first, S sent, std::size_t bound, Proj proj = {}) const {
+				auto last = __stl2::next(first, std::move(sent));
+				const auto n = iter_difference_t<I>(last - first);
+				auto key = [&proj](auto&& x) {
+					return detail::__histogram_index(__stl2::invoke(proj,
+						static_cast<decltype(x)>(x)));
+				};
+				const bool sorted = bound <= std::size_t{1} << 16
+					? detail::__counting_sort_n<std::uint16_t>(first, n, bound, key)
+					: detail::__counting_sort_n<std::size_t>(first, n, bound, key);
+				if (!sorted) {
+					__stl2::stable_sort(first, last, less{}, key);
+				}
+				return last;
+			}
+
+			template<RandomAccessRange R, class Proj = identity>
+			requires Permutable<iterator_t<R>> &&
+				detail::__histogram_key<__uncvref<indirect_result_t<Proj&, iterator_t<R>>>>
+			safe_iterator_t<R> operator()(R&& r, std::size_t bound, Proj proj = {}) const {
+				return (*this)(__stl2::begin(r), __stl2::end(r), bound,
+					__stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __counting_sort_fn counting_sort {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
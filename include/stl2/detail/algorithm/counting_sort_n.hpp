@@ -0,0 +1,118 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_COUNTING_SORT_N_HPP
+#define STL2_DETAIL_ALGORITHM_COUNTING_SORT_N_HPP
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/algorithm/histogram.hpp>
+#include <stl2/detail/algorithm/radix_sort.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Counting sort
+// The counting pass shared by ext::counting_sort and, for small integer
+// keys, by sort and stable_sort.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Stably sort the n elements at first by key(*(first + i)) < bins,
+		// recording the keys as K. The elements, keys and counts are all
+		// held in temporary buffers; returns false, leaving the range
+		// alone, if any is unavailable.
+		template<class K, RandomAccessIterator I, class Key>
+		requires Permutable<I>
+		bool __counting_sort_n(I first, iter_difference_t<I> n, std::size_t bins,
+			Key key)
+		{
+			using D = iter_difference_t<I>;
+			if (n < 2) return true;
+			temporary_buffer<iter_value_t<I>> buf{n};
+			if (buf.size() < n) return false;
+			temporary_buffer<K> keys{n};
+			if (keys.size() < n) return false;
+			const bool split = __split_counts(first, first + n, bins);
+			const auto n_counts =
+				static_cast<std::ptrdiff_t>(split ? __count_ways * bins : bins);
+			temporary_buffer<D> counts{n_counts};
+			if (counts.size() < n_counts) return false;
+			D* const offsets = counts.data();
+			std::uninitialized_fill_n(offsets, n_counts, D{0});
+
+			// __count_keys_into visits the elements in order, once each.
+			K* next_key = keys.data();
+			__count_keys_into(offsets, split, first, first + n, bins,
+				[&key, &next_key](auto&& x) {
+					const std::size_t k = key(static_cast<decltype(x)>(x));
+					*next_key++ = static_cast<K>(k);
+					return k;
+				});
+			D sum = 0;
+			for (std::size_t b = 0; b < bins; ++b) {
+				if (offsets[b] == n) return true;
+				sum += std::exchange(offsets[b], sum);
+			}
+
+			temporary_vector<iter_value_t<I>> tmp{buf};
+			for (D i = 0; i < n; ++i) {
+				tmp.emplace_back(__stl2::iter_move(first + i));
+			}
+			const K* k = keys.data();
+			for (auto& x : tmp) {
+				*(first + offsets[*k++]++) = std::move(x);
+			}
+			return true;
+		}
+
+		template<class K>
+		META_CONCEPT __small_sort_key = (__radix_key<K> || std::is_enum_v<K>) &&
+			!std::is_floating_point_v<K> && sizeof(K) <= 2;
+
+		// sort and stable_sort by counting when comp is less or greater on
+		// small integer keys. Returns false if [first, first + n) is left
+		// unsorted.
+		template<RandomAccessIterator I, class Comp, class Proj>
+		requires Permutable<I>
+		bool __try_counting_sort(I first, iter_difference_t<I> n, Comp&, Proj& proj) {
+			using K = __uncvref<invoke_result_t<Proj&, iter_reference_t<I>>>;
+			constexpr bool ascending = __same_function_object<Comp, less>;
+			constexpr bool descending = __same_function_object<Comp, greater>;
+			if constexpr (__small_sort_key<K> && (ascending || descending)) {
+				constexpr std::size_t bins = std::size_t{1} << (sizeof(K) * CHAR_BIT);
+				// Below this the counts cost more than comparisons.
+				constexpr std::ptrdiff_t threshold = 2 * bins;
+				if (n < threshold) return false;
+				return __counting_sort_n<std::uint16_t>(first, n, bins, [&proj](auto&& x) {
+					auto&& k = __stl2::invoke(proj, static_cast<decltype(x)>(x));
+					std::size_t i;
+					if constexpr (std::is_enum_v<K>) {
+						i = radix_key(static_cast<std::underlying_type_t<K>>(k));
+					} else {
+						i = radix_key(static_cast<K>(k));
+					}
+					return ascending ? i : bins - 1 - i;
+				});
+			} else {
+				return false;
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -12,11 +12,15 @@
 #ifndef STL2_DETAIL_ALGORITHM_EQUAL_HPP
 #define STL2_DETAIL_ALGORITHM_EQUAL_HPP
 
+#include <stl2/detail/algorithm/first_difference.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // equal [alg.equal]
+// Contiguous ranges of scalars compared by equal_to are compared by
+// memcmp or a vectorized scan; see first_difference.hpp.
 //
 STL2_OPEN_NAMESPACE {
 	struct __equal_fn : private __niebloid {
@@ -61,12 +65,27 @@ STL2_OPEN_NAMESPACE {
 		constexpr bool operator()(I1 first1, S1 last1, I2 first2, S2 last2, Pred pred = {},
 			Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
-			if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2>) {
+			if constexpr (ext::Unwrappable<I1, S1> || ext::Unwrappable<I2, S2>) {
+				auto [ufirst1, ulast1] = ext::unwrap(std::move(first1), std::move(last1));
+				auto [ufirst2, ulast2] = ext::unwrap(std::move(first2), std::move(last2));
+				return (*this)(std::move(ufirst1), std::move(ulast1),
+					std::move(ufirst2), std::move(ulast2), __stl2::ref(pred),
+					__stl2::ref(proj1), __stl2::ref(proj2));
+			} else if constexpr (SizedSentinel<S1, I1> && SizedSentinel<S2, I2>) {
 				auto len1 = distance(first1, last1);
 				auto len2 = distance(first2, std::move(last2));
-				return len1 == len2 &&
-					__equal_3(std::move(first1), std::move(last1),
-						std::move(first2), pred, proj1, proj2);
+				if (len1 != len2) return false;
+				if constexpr (detail::__comparable_contiguous<I1, I2, Proj1, Proj2> &&
+					detail::__first_difference_element<iter_value_t<I1>> &&
+					__same_function_object<Pred, equal_to>)
+				{
+					if (!detail::__is_constant_evaluated()) {
+						return detail::__equal_contiguous<iter_value_t<I1>>(
+							first1, first2, static_cast<std::size_t>(len1));
+					}
+				}
+				return __equal_3(std::move(first1), std::move(last1),
+					std::move(first2), pred, proj1, proj2);
 			} else {
 				return __equal_4(
 					std::move(first1), std::move(last1),
@@ -81,7 +100,12 @@ STL2_OPEN_NAMESPACE {
 		constexpr bool operator()(R1&& r1, R2&& r2, Pred pred = {},
 			Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
-			if constexpr (SizedRange<R1> && SizedRange<R2>) {
+			if constexpr (SizedSentinel<sentinel_t<R1>, iterator_t<R1>> &&
+				SizedSentinel<sentinel_t<R2>, iterator_t<R2>>)
+			{
+				return (*this)(begin(r1), end(r1), begin(r2), end(r2),
+					__stl2::ref(pred), __stl2::ref(proj1), __stl2::ref(proj2));
+			} else if constexpr (SizedRange<R1> && SizedRange<R2>) {
 				return distance(r1) == distance(r2) &&
 					__equal_3(
 						begin(r1), end(r1),
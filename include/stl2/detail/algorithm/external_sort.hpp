@@ -0,0 +1,506 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_EXTERNAL_SORT_HPP
+#define STL2_DETAIL_ALGORITHM_EXTERNAL_SORT_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/merge_k.hpp>
+#include <stl2/detail/algorithm/results.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/dangling.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// external_sort [Extension]
+// Sort more fixed-size records than fit in memory. The input is read into
+// a buffer of half the memory budget, which is sorted and written to a
+// temporary file in temp_dir while the other half fills with the next
+// run. The runs are then merged with a loser tree - see merge_k - reading
+// each run through a pair of blocks so that one is refilled in the
+// background while the other is consumed. When there are more runs than
+// can be merged at once - 64, or fewer if the budget cannot give each run
+// blocks of at least 64 KiB - groups of runs are first merged into longer
+// runs, again writing each through a pair of blocks. The final merge
+// writes to the output. Input that fits in one buffer is sorted in memory
+// and never touches the disk. The sort is not stable.
+//
+// All the reads and writes are done in the order they are requested, on
+// one thread started once the input is known not to fit. A run's file is
+// open only while the run is written or merged, so the sort holds no more
+// than 65 files open at once.
+//
+// Records are copied to and from the files byte for byte, so the value
+// type must be trivially copyable. The temporary files are removed
+// before returning, and std::system_error is thrown if one cannot be
+// created, written or read.
+//
+// Since it needs threads and <filesystem>, external_sort is not included
+// by <stl2/algorithm.hpp>; include this header to use it.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// A temporary file, created exclusively and removed on destruction.
+		class __spill_file {
+			std::FILE* file_ = nullptr;
+			std::filesystem::path path_;
+
+			[[noreturn]] void fail(const char* what) const {
+				const int e = errno;
+				throw std::system_error(e ? e : EIO, std::generic_category(),
+					std::string("external_sort: cannot ") + what + " " + path_.string());
+			}
+		public:
+			explicit __spill_file(const std::filesystem::path& dir) {
+				std::random_device rd;
+				for (int tries = 0; tries < 16; ++tries) {
+					const auto tag = (std::uint64_t{rd()} << 32) | rd();
+					path_ = dir / ("stl2-external-sort-" + std::to_string(tag));
+					errno = 0;
+					if ((file_ = std::fopen(path_.c_str(), "w+bx"))) return;
+					if (errno != EEXIST) break;
+				}
+				fail("create");
+			}
+			__spill_file(__spill_file&& that) noexcept
+			: file_(std::exchange(that.file_, nullptr))
+			, path_(std::exchange(that.path_, {})) {}
+			__spill_file& operator=(__spill_file&& that) noexcept {
+				std::swap(file_, that.file_);
+				std::swap(path_, that.path_);
+				return *this;
+			}
+			~__spill_file() {
+				if (file_) std::fclose(file_);
+				if (!path_.empty()) {
+					std::error_code ec;
+					std::filesystem::remove(path_, ec);
+				}
+			}
+
+			template<class T>
+			void write(const T* p, std::size_t n) {
+				if (std::fwrite(p, sizeof(T), n, file_) != n) fail("write");
+			}
+
+			template<class T>
+			void read(T* p, std::size_t n) {
+				if (std::fread(p, sizeof(T), n, file_) != n) fail("read");
+			}
+
+			// Close the file, keeping it on disk until destruction.
+			void close() {
+				if (file_ && std::fclose(std::exchange(file_, nullptr)) != 0) {
+					fail("close");
+				}
+			}
+
+			// Read from the start, reopening the file if it is closed.
+			void rewind() {
+				if (!file_) {
+					errno = 0;
+					if (!(file_ = std::fopen(path_.c_str(), "rb"))) fail("open");
+				} else if (std::fflush(file_) != 0 ||
+					std::fseek(file_, 0, SEEK_SET) != 0) {
+					fail("rewind");
+				}
+			}
+		};
+
+		// A thread that runs the reads and writes of every stream, one
+		// block at a time and in the order they are posted, while the
+		// callers go on with their work. post returns a ticket for the job,
+		// to wait on; a ticket of zero is already done.
+		class __spill_io {
+			std::mutex mutex_;
+			std::condition_variable cv_;
+			std::deque<std::function<void()>> jobs_;
+			std::uint64_t posted_ = 0;
+			std::uint64_t done_ = 0;
+			std::exception_ptr error_;
+			bool stop_ = false;
+			std::thread thread_;
+
+			void run() {
+				std::unique_lock<std::mutex> lock{mutex_};
+				while (true) {
+					cv_.wait(lock, [this] { return !jobs_.empty() || stop_; });
+					if (jobs_.empty()) return;
+					auto job = std::move(jobs_.front());
+					jobs_.pop_front();
+					lock.unlock();
+					std::exception_ptr e;
+					try {
+						job();
+					} catch (...) {
+						e = std::current_exception();
+					}
+					lock.lock();
+					if (e && !error_) error_ = std::move(e);
+					++done_;
+					cv_.notify_all();
+				}
+			}
+		public:
+			__spill_io() : thread_([this] { run(); }) {}
+			__spill_io(const __spill_io&) = delete;
+			__spill_io& operator=(const __spill_io&) = delete;
+			// Finishes the jobs posted so far.
+			~__spill_io() {
+				{
+					std::lock_guard<std::mutex> lock{mutex_};
+					stop_ = true;
+				}
+				cv_.notify_all();
+				thread_.join();
+			}
+
+			template<class F>
+			std::uint64_t post(F f) {
+				std::uint64_t ticket;
+				{
+					std::lock_guard<std::mutex> lock{mutex_};
+					jobs_.emplace_back(std::move(f));
+					ticket = ++posted_;
+				}
+				cv_.notify_all();
+				return ticket;
+			}
+
+			// Wait for the job with the given ticket, and rethrow the first
+			// exception thrown by any job.
+			void wait(std::uint64_t ticket) {
+				std::unique_lock<std::mutex> lock{mutex_};
+				cv_.wait(lock, [&] { return done_ >= ticket; });
+				if (error_) std::rethrow_exception(error_);
+			}
+
+			// Wait for the job with the given ticket, ignoring errors; for
+			// destructors that must not free a block still in use.
+			void drain(std::uint64_t ticket) noexcept {
+				std::unique_lock<std::mutex> lock{mutex_};
+				cv_.wait(lock, [&] { return done_ >= ticket; });
+			}
+		};
+
+		template<class T>
+		struct __spill_run {
+			__spill_file file;
+			std::size_t size;
+		};
+
+		// Reads a run a block at a time, with the next block in flight.
+		template<class T>
+		class __spill_reader {
+			__spill_io* io_;
+			__spill_file* file_;
+			std::size_t unread_;
+			std::vector<T> cur_, ahead_;
+			std::size_t pos_ = 0;
+			std::size_t size_ = 0;
+			// The number of records being read into ahead_, if any are.
+			std::size_t pending_ = 0;
+			std::uint64_t ticket_ = 0;
+
+			void request() {
+				const std::size_t n = std::min(unread_, ahead_.size());
+				unread_ -= n;
+				pending_ = n;
+				ticket_ = io_->post([f = file_, p = ahead_.data(), n] { f->read(p, n); });
+			}
+
+			void advance() {
+				pos_ = 0;
+				size_ = 0;
+				if (pending_ == 0) return;
+				io_->wait(ticket_);
+				size_ = std::exchange(pending_, 0);
+				cur_.swap(ahead_);
+				if (unread_ > 0) request();
+			}
+		public:
+			__spill_reader(__spill_io& io, __spill_run<T>& run, std::size_t block)
+			: io_(&io), file_(&run.file), unread_(run.size), cur_(block), ahead_(block) {
+				file_->rewind();
+				if (unread_ > 0) request();
+				advance();
+			}
+			__spill_reader(__spill_reader&& that) noexcept
+			: io_(that.io_), file_(that.file_), unread_(that.unread_)
+			, cur_(std::move(that.cur_)), ahead_(std::move(that.ahead_))
+			, pos_(that.pos_), size_(that.size_), pending_(that.pending_)
+			, ticket_(std::exchange(that.ticket_, 0)) {}
+			__spill_reader& operator=(__spill_reader&&) = delete;
+			~__spill_reader() { io_->drain(ticket_); }
+
+			bool done() const noexcept { return pos_ == size_; }
+			T& head() noexcept { return cur_[pos_]; }
+			void next() { if (++pos_ == size_) advance(); }
+		};
+
+		// The heads of a run, as an input iterator for loser_tree.
+		template<class T>
+		class __spill_iterator {
+			__spill_reader<T>* reader_ = nullptr;
+
+			bool done() const { return reader_->done(); }
+		public:
+			using iterator_category = __stl2::input_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+
+			__spill_iterator() = default;
+			explicit __spill_iterator(__spill_reader<T>& reader) noexcept
+			: reader_(&reader) {}
+
+			T& operator*() const noexcept { return reader_->head(); }
+			__spill_iterator& operator++() {
+				reader_->next();
+				return *this;
+			}
+			void operator++(int) { ++*this; }
+
+			friend bool operator==(const __spill_iterator& x, default_sentinel)
+			{ return x.done(); }
+			friend bool operator==(default_sentinel y, const __spill_iterator& x)
+			{ return x == y; }
+			friend bool operator!=(const __spill_iterator& x, default_sentinel y)
+			{ return !(x == y); }
+			friend bool operator!=(default_sentinel y, const __spill_iterator& x)
+			{ return !(x == y); }
+		};
+
+		// Writes a run a block at a time, with the previous block in flight.
+		template<class T>
+		class __spill_writer {
+			__spill_io* io_;
+			__spill_file* file_;
+			std::vector<T> cur_, behind_;
+			std::size_t pos_ = 0;
+			std::size_t size_ = 0;
+			std::uint64_t ticket_ = 0;
+
+			void flush() {
+				if (pos_ == 0) return;
+				io_->wait(ticket_);
+				cur_.swap(behind_);
+				ticket_ = io_->post([f = file_, p = behind_.data(), n = pos_] {
+					f->write(p, n);
+				});
+				size_ += pos_;
+				pos_ = 0;
+			}
+		public:
+			__spill_writer(__spill_io& io, __spill_file& file, std::size_t block)
+			: io_(&io), file_(&file), cur_(block), behind_(block) {}
+			__spill_writer(const __spill_writer&) = delete;
+			__spill_writer& operator=(const __spill_writer&) = delete;
+			~__spill_writer() { io_->drain(ticket_); }
+
+			void push(const T& x) {
+				cur_[pos_] = x;
+				if (++pos_ == cur_.size()) flush();
+			}
+
+			// Write what is left and close the file. Returns the number of
+			// records written.
+			std::size_t finish() {
+				flush();
+				io_->wait(ticket_);
+				file_->close();
+				return size_;
+			}
+		};
+
+		template<class T>
+		META_CONCEPT __spillable = Semiregular<T> && std::is_trivially_copyable_v<T>;
+	}
+
+	namespace ext {
+		template<class I, class O>
+		using external_sort_result = __in_out_result<I, O>;
+
+		struct __external_sort_fn : private __niebloid {
+			static constexpr std::size_t default_memory_budget = std::size_t{1} << 28;
+			static constexpr std::size_t min_block_bytes = std::size_t{1} << 16;
+			static constexpr std::size_t max_fan_in = 64;
+
+			template<InputIterator I, Sentinel<I> S, WeaklyIncrementable O,
+				class Comp = less, class Proj = identity>
+			requires detail::__spillable<iter_value_t<I>> &&
+				IndirectlyCopyable<I, iter_value_t<I>*> &&
+				Sortable<iter_value_t<I>*, Comp, Proj> &&
+				IndirectlyCopyable<iter_value_t<I>*, O>
+			external_sort_result<I, O>
+			operator()(I first, S last, O result, Comp comp = {}, Proj proj = {},
+				std::size_t memory_budget = default_memory_budget,
+				const std::filesystem::path& temp_dir = {}) const
+			{
+				using T = iter_value_t<I>;
+				using run_t = detail::__spill_run<T>;
+				const std::size_t capacity =
+					std::max(memory_budget / (2 * sizeof(T)), std::size_t{1});
+
+				std::vector<T> buf, spare;
+				buf.reserve(capacity);
+				auto fill = [&] {
+					buf.clear();
+					for (; buf.size() < capacity && first != last; ++first) {
+						buf.push_back(*first);
+					}
+					__stl2::sort(buf, __stl2::ref(comp), __stl2::ref(proj));
+				};
+
+				fill();
+				if (first == last) {
+					for (auto& x : buf) {
+						*result = x;
+						++result;
+					}
+					return {std::move(first), std::move(result)};
+				}
+
+				const auto dir = temp_dir.empty()
+					? std::filesystem::temp_directory_path() : temp_dir;
+				std::vector<run_t> runs;
+				// Declared after the buffers and runs, to finish with them
+				// before they are freed.
+				detail::__spill_io io;
+				spare.reserve(capacity);
+				{
+					// Each run is written while the next is read and sorted.
+					std::uint64_t written = 0;
+					while (true) {
+						io.wait(written);
+						runs.push_back(run_t{detail::__spill_file{dir}, buf.size()});
+						written = io.post([f = &runs.back().file, p = buf.data(),
+							n = buf.size()] {
+							f->write(p, n);
+							f->close();
+						});
+						if (first == last) break;
+						buf.swap(spare);
+						fill();
+					}
+					io.wait(written);
+				}
+				std::vector<T>().swap(spare);
+				std::vector<T>().swap(buf);
+
+				const std::size_t fan_in = std::min(max_fan_in, std::max(
+					memory_budget / (2 * min_block_bytes), std::size_t{3}) - 1);
+				while (runs.size() > fan_in) {
+					std::vector<run_t> merged;
+					for (std::size_t i = 0; i < runs.size(); i += fan_in) {
+						const std::size_t k = std::min(fan_in, runs.size() - i);
+						if (k == 1) {
+							merged.push_back(std::move(runs[i]));
+							continue;
+						}
+						detail::__spill_file file{dir};
+						{
+							detail::__spill_writer<T> out{io, file,
+								block<T>(memory_budget, k + 1)};
+							merge(io, runs.data() + i, k, memory_budget,
+								[&out](T& x) { out.push(x); }, comp, proj);
+							const std::size_t n = out.finish();
+							merged.push_back(run_t{std::move(file), n});
+						}
+					}
+					runs.swap(merged);
+				}
+
+				merge(io, runs.data(), runs.size(), memory_budget, [&result](T& x) {
+					*result = x;
+					++result;
+				}, comp, proj);
+				return {std::move(first), std::move(result)};
+			}
+
+			template<InputRange R, WeaklyIncrementable O, class Comp = less,
+				class Proj = identity>
+			requires detail::__spillable<iter_value_t<iterator_t<R>>> &&
+				IndirectlyCopyable<iterator_t<R>, iter_value_t<iterator_t<R>>*> &&
+				Sortable<iter_value_t<iterator_t<R>>*, Comp, Proj> &&
+				IndirectlyCopyable<iter_value_t<iterator_t<R>>*, O>
+			external_sort_result<safe_iterator_t<R>, O>
+			operator()(R&& r, O result, Comp comp = {}, Proj proj = {},
+				std::size_t memory_budget = default_memory_budget,
+				const std::filesystem::path& temp_dir = {}) const
+			{
+				return (*this)(__stl2::begin(r), __stl2::end(r), std::move(result),
+					__stl2::ref(comp), __stl2::ref(proj), memory_budget, temp_dir);
+			}
+
+		private:
+			// Records per block when the budget is shared by n double-buffered
+			// streams.
+			template<class T>
+			static constexpr std::size_t block(std::size_t memory_budget,
+				std::size_t n) noexcept
+			{ return std::max(memory_budget / (2 * n * sizeof(T)), std::size_t{1}); }
+
+			// Merge the k runs into sink, closing their files when done.
+			template<class T, class F, class Comp, class Proj>
+			static void merge(detail::__spill_io& io, detail::__spill_run<T>* runs,
+				std::size_t k, std::size_t memory_budget, F sink, Comp& comp,
+				Proj& proj)
+			{
+				using It = detail::__spill_iterator<T>;
+				const std::size_t n = block<T>(memory_budget, k + 1);
+				{
+					std::vector<detail::__spill_reader<T>> readers;
+					readers.reserve(k);
+					for (std::size_t i = 0; i < k; ++i) {
+						readers.emplace_back(io, runs[i], n);
+					}
+					detail::__loser_tree_for<It, default_sentinel, Proj> tree;
+					for (auto& r : readers) {
+						tree.push(It{r}, default_sentinel{});
+					}
+					tree.build(comp, proj);
+					tree.drain([&sink](It& i) { sink(*i); }, comp, proj);
+				}
+				for (std::size_t i = 0; i < k; ++i) {
+					runs[i].file.close();
+				}
+			}
+		};
+
+		inline constexpr __external_sort_fn external_sort {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
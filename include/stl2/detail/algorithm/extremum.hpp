@@ -0,0 +1,251 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_EXTREMUM_HPP
+#define STL2_DETAIL_ALGORITHM_EXTREMUM_HPP
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// Vectorized extrema
+// The kernels of min_element, max_element and minmax_element over
+// contiguous ranges of arithmetic values ordered by less. The range is
+// cut into blocks of 8 KiB, and the least and greatest values of each
+// block found with vector min and max across the lanes. The block in
+// which the running extremum last changed - the first block holding the
+// least value, and the first or last holding the greatest - is then
+// searched for that value's first or last position, a vector at a time.
+// Selected at compile time for AVX2; other builds keep the scalar loops.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class T>
+		struct __extremum_result {
+			const T* min;
+			const T* max;
+		};
+
+#if defined(__AVX2__)
+		template<class T>
+		META_CONCEPT __simd_extremum_element = std::is_arithmetic_v<T> &&
+			!Same<T, bool> && sizeof(T) <= 8 &&
+			(std::is_integral_v<T> || Same<T, float> || Same<T, double>);
+
+		template<class I, class S, class Comp, class Proj>
+		META_CONCEPT __simd_extremum = std::is_pointer_v<I> && Same<I, S> &&
+			(Same<iter_reference_t<I>, iter_value_t<I>&> ||
+			 Same<iter_reference_t<I>, const iter_value_t<I>&>) &&
+			__simd_extremum_element<iter_value_t<I>> &&
+			__same_function_object<Comp, less> &&
+			__same_function_object<Proj, identity>;
+
+		template<class T>
+		inline __m256i __simd_load(const T* p) noexcept {
+			return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+		}
+
+		template<class T>
+		inline __m256i __simd_splat(T x) noexcept {
+			if constexpr (Same<T, float>) {
+				return _mm256_castps_si256(_mm256_set1_ps(x));
+			} else if constexpr (Same<T, double>) {
+				return _mm256_castpd_si256(_mm256_set1_pd(x));
+			} else if constexpr (sizeof(T) == 1) {
+				return _mm256_set1_epi8(static_cast<char>(x));
+			} else if constexpr (sizeof(T) == 2) {
+				return _mm256_set1_epi16(static_cast<short>(x));
+			} else if constexpr (sizeof(T) == 4) {
+				return _mm256_set1_epi32(static_cast<int>(x));
+			} else {
+				return _mm256_set1_epi64x(static_cast<long long>(x));
+			}
+		}
+
+		// The lanes of a, or of b, that come first (Max = false) or last in
+		// the order of T.
+		template<bool Max, class T>
+		inline __m256i __simd_pick(__m256i a, __m256i b) noexcept {
+			constexpr bool s = std::is_signed_v<T>;
+			if constexpr (Same<T, float>) {
+				const __m256 x = _mm256_castsi256_ps(a), y = _mm256_castsi256_ps(b);
+				return _mm256_castps_si256(Max ? _mm256_max_ps(x, y) : _mm256_min_ps(x, y));
+			} else if constexpr (Same<T, double>) {
+				const __m256d x = _mm256_castsi256_pd(a), y = _mm256_castsi256_pd(b);
+				return _mm256_castpd_si256(Max ? _mm256_max_pd(x, y) : _mm256_min_pd(x, y));
+			} else if constexpr (sizeof(T) == 1) {
+				return Max ? (s ? _mm256_max_epi8(a, b) : _mm256_max_epu8(a, b))
+					: (s ? _mm256_min_epi8(a, b) : _mm256_min_epu8(a, b));
+			} else if constexpr (sizeof(T) == 2) {
+				return Max ? (s ? _mm256_max_epi16(a, b) : _mm256_max_epu16(a, b))
+					: (s ? _mm256_min_epi16(a, b) : _mm256_min_epu16(a, b));
+			} else if constexpr (sizeof(T) == 4) {
+				return Max ? (s ? _mm256_max_epi32(a, b) : _mm256_max_epu32(a, b))
+					: (s ? _mm256_min_epi32(a, b) : _mm256_min_epu32(a, b));
+			} else {
+				// No 64-bit min and max before AVX-512: compare and blend,
+				// with the sign bits flipped for unsigned order.
+				const __m256i bias = s ? _mm256_setzero_si256()
+					: _mm256_set1_epi64x(std::numeric_limits<long long>::min());
+				const __m256i gt = _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias),
+					_mm256_xor_si256(b, bias));
+				return Max ? _mm256_blendv_epi8(b, a, gt) : _mm256_blendv_epi8(a, b, gt);
+			}
+		}
+
+		// One bit per byte of the lanes of x neither less nor greater
+		// than v.
+		template<class T>
+		inline unsigned __simd_equivalent(__m256i x, __m256i v) noexcept {
+			__m256i eq;
+			if constexpr (Same<T, float>) {
+				eq = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(x),
+					_mm256_castsi256_ps(v), _CMP_EQ_UQ));
+			} else if constexpr (Same<T, double>) {
+				eq = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(x),
+					_mm256_castsi256_pd(v), _CMP_EQ_UQ));
+			} else if constexpr (sizeof(T) == 1) {
+				eq = _mm256_cmpeq_epi8(x, v);
+			} else if constexpr (sizeof(T) == 2) {
+				eq = _mm256_cmpeq_epi16(x, v);
+			} else if constexpr (sizeof(T) == 4) {
+				eq = _mm256_cmpeq_epi32(x, v);
+			} else {
+				eq = _mm256_cmpeq_epi64(x, v);
+			}
+			return static_cast<unsigned>(_mm256_movemask_epi8(eq));
+		}
+
+		template<class T>
+		struct __extrema {
+			T min;
+			T max;
+		};
+
+		// The least and greatest values of the nonempty [first, last).
+		template<bool Min, bool Max, class T>
+		__extrema<T> __simd_block_extrema(const T* first, const T* const last) noexcept {
+			constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+			__extrema<T> r{*first, *first};
+			if (last - first >= lanes) {
+				__m256i lo = __simd_load(first), hi = lo;
+				for (first += lanes; last - first >= lanes; first += lanes) {
+					const __m256i x = __simd_load(first);
+					if constexpr (Min) lo = __simd_pick<false, T>(lo, x);
+					if constexpr (Max) hi = __simd_pick<true, T>(hi, x);
+				}
+				alignas(32) T l[lanes], h[lanes];
+				_mm256_store_si256(reinterpret_cast<__m256i*>(l), lo);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(h), hi);
+				r = {l[0], h[0]};
+				for (std::ptrdiff_t i = 1; i < lanes; ++i) {
+					if (l[i] < r.min) r.min = l[i];
+					if (r.max < h[i]) r.max = h[i];
+				}
+			}
+			for (; first != last; ++first) {
+				if (*first < r.min) r.min = *first;
+				if (r.max < *first) r.max = *first;
+			}
+			return r;
+		}
+
+		// The first (Last = false) or last element of [first, last)
+		// equivalent to v, or first if there is none.
+		template<bool Last, class T>
+		const T* __simd_find_equivalent(const T* const first, const T* const last,
+			const T v) noexcept
+		{
+			constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+			auto equivalent = [v](T x) { return !(x < v) && !(v < x); };
+			const __m256i vv = __simd_splat(v);
+			const T* const tail = first + (last - first) / lanes * lanes;
+			if constexpr (!Last) {
+				for (const T* p = first; p != tail; p += lanes) {
+					if (unsigned m = __simd_equivalent<T>(__simd_load(p), vv)) {
+						return p + __builtin_ctz(m) / sizeof(T);
+					}
+				}
+				for (const T* p = tail; p != last; ++p) {
+					if (equivalent(*p)) return p;
+				}
+			} else {
+				for (const T* p = last; p != tail;) {
+					if (equivalent(*--p)) return p;
+				}
+				for (const T* p = tail; p != first;) {
+					p -= lanes;
+					if (unsigned m = __simd_equivalent<T>(__simd_load(p), vv)) {
+						return p + (31 - __builtin_clz(m)) / sizeof(T);
+					}
+				}
+			}
+			return first;
+		}
+
+		// The first least element of the nonempty [first, last) if Min, and
+		// the first or, if LastMax, last greatest if Max.
+		template<bool Min, bool Max, bool LastMax, class T>
+		__extremum_result<T> __simd_extremum_positions(const T* const first,
+			const T* const last) noexcept
+		{
+			constexpr std::ptrdiff_t block = 8192 / sizeof(T);
+			auto block_end = [last](const T* b) {
+				return last - b < block ? last : b + block;
+			};
+			auto best = __simd_block_extrema<Min, Max>(first, block_end(first));
+			const T* min_block = first;
+			const T* max_block = first;
+			for (const T* b = block_end(first); b != last; b = block_end(b)) {
+				const auto e = __simd_block_extrema<Min, Max>(b, block_end(b));
+				if constexpr (Min) {
+					if (e.min < best.min) {
+						best.min = e.min;
+						min_block = b;
+					}
+				}
+				if constexpr (Max) {
+					if (LastMax ? !(e.max < best.max) : best.max < e.max) {
+						best.max = e.max;
+						max_block = b;
+					}
+				}
+			}
+			__extremum_result<T> r{first, first};
+			if constexpr (Min) {
+				r.min = __simd_find_equivalent<false>(min_block,
+					block_end(min_block), best.min);
+			}
+			if constexpr (Max) {
+				r.max = __simd_find_equivalent<LastMax>(max_block,
+					block_end(max_block), best.max);
+			}
+			return r;
+		}
+#else // ^^^ __AVX2__ / no AVX2 vvv
+		template<class I, class S, class Comp, class Proj>
+		META_CONCEPT __simd_extremum = false;
+
+		template<bool Min, bool Max, bool LastMax, class T>
+		__extremum_result<T> __simd_extremum_positions(const T*, const T*) noexcept;
+#endif // __AVX2__
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -12,6 +12,7 @@
 #ifndef STL2_DETAIL_ALGORITHM_FILL_HPP
 #define STL2_DETAIL_ALGORITHM_FILL_HPP
 
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/concepts.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
@@ -21,10 +22,16 @@ STL2_OPEN_NAMESPACE {
 	struct __fill_fn : private __niebloid {
 		template<class T, OutputIterator<const T&> O, Sentinel<O> S>
 		constexpr O operator()(O first, S last, const T& value) const {
-			for (; first != last; ++first) {
-				*first = value;
+			if constexpr (ext::Unwrappable<O, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				return ext::rewrap(std::move(first), ufirst,
+					(*this)(ufirst, std::move(ulast), value));
+			} else {
+				for (; first != last; ++first) {
+					*first = value;
+				}
+				return first;
 			}
-			return first;
 		}
 
 		template<class T, OutputRange<const T&> R>
@@ -13,6 +13,8 @@
 #define STL2_DETAIL_ALGORITHM_FIND_HPP
 
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -24,12 +26,24 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectRelation<equal_to, projected<I, Proj>, const T*>
 		constexpr I
 		operator()(I first, S last, const T& value, Proj proj = {}) const {
-			for (; first != last; ++first) {
-				if (__stl2::invoke(proj, *first) == value) {
-					break;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				return ext::rewrap(std::move(first), ufirst,
+					(*this)(ufirst, std::move(ulast), value, __stl2::ref(proj)));
+			} else if constexpr (ext::SegmentedSentinel<S, I>) {
+				return detail::segmented_walk(std::move(first), last,
+					[&](auto lfirst, const auto& llast) {
+						return (*this)(std::move(lfirst), llast, value,
+							__stl2::ref(proj));
+					});
+			} else {
+				for (; first != last; ++first) {
+					if (__stl2::invoke(proj, *first) == value) {
+						break;
+					}
 				}
+				return first;
 			}
-			return first;
 		}
 
 		template<InputRange R, class T, class Proj = identity>
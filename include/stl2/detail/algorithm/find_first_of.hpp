@@ -12,7 +12,9 @@
 #ifndef STL2_DETAIL_ALGORITHM_FIND_FIRST_OF_HPP
 #define STL2_DETAIL_ALGORITHM_FIND_FIRST_OF_HPP
 
+#include <stl2/detail/algorithm/char_scan.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/concepts.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
@@ -27,16 +29,39 @@ STL2_OPEN_NAMESPACE {
 		constexpr I1 operator()(I1 first1, S1 last1, I2 first2, S2 last2,
 			Pred pred = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
-			for (; first1 != last1; ++first1) {
-				for (auto pos = first2; pos != last2; ++pos) {
-					if (__stl2::invoke(pred,
-							__stl2::invoke(proj1, *first1),
-							__stl2::invoke(proj2, *pos))) {
-						return first1;
+			if constexpr (ext::Unwrappable<I1, S1>) {
+				auto [ufirst, ulast] = ext::unwrap(first1, std::move(last1));
+				return ext::rewrap(std::move(first1), ufirst,
+					(*this)(ufirst, std::move(ulast), std::move(first2),
+						std::move(last2), __stl2::ref(pred), __stl2::ref(proj1),
+						__stl2::ref(proj2)));
+			} else {
+				if constexpr (detail::__char_scannable<I1, S1> &&
+					Same<iter_value_t<I1>, iter_value_t<I2>> &&
+					__same_function_object<Pred, equal_to> &&
+					__same_function_object<Proj1, identity> &&
+					__same_function_object<Proj2, identity>)
+				{
+					// Seek the members of the set of characters [first2, last2).
+					if (!detail::__is_constant_evaluated()) {
+						ext::char_set set;
+						for (; first2 != last2; ++first2) {
+							set.insert(static_cast<iter_value_t<I2>>(*first2));
+						}
+						return first1 + (detail::__find_char_set(first1, last1, set) - first1);
 					}
 				}
+				for (; first1 != last1; ++first1) {
+					for (auto pos = first2; pos != last2; ++pos) {
+						if (__stl2::invoke(pred,
+								__stl2::invoke(proj1, *first1),
+								__stl2::invoke(proj2, *pos))) {
+							return first1;
+						}
+					}
+				}
+				return first1;
 			}
-			return first1;
 		}
 
 		template<InputRange R1, ForwardRange R2,
@@ -12,7 +12,10 @@
 #ifndef STL2_DETAIL_ALGORITHM_FIND_IF_HPP
 #define STL2_DETAIL_ALGORITHM_FIND_IF_HPP
 
+#include <stl2/detail/algorithm/char_scan.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -24,12 +27,33 @@ STL2_OPEN_NAMESPACE {
 			IndirectUnaryPredicate<projected<I, Proj>> Pred>
 		constexpr I
 		operator()(I first, S last, Pred pred, Proj proj = {}) const {
-			for (; first != last; ++first) {
-				if (__stl2::invoke(pred, __stl2::invoke(proj, *first))) {
-					break;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				return ext::rewrap(std::move(first), ufirst,
+					(*this)(ufirst, std::move(ulast), __stl2::ref(pred),
+						__stl2::ref(proj)));
+			} else if constexpr (ext::SegmentedSentinel<S, I>) {
+				return detail::segmented_walk(std::move(first), last,
+					[&](auto lfirst, const auto& llast) {
+						return (*this)(std::move(lfirst), llast, __stl2::ref(pred),
+							__stl2::ref(proj));
+					});
+			} else {
+				if constexpr (detail::__char_scannable<I, S> &&
+					detail::__char_set_predicate<Pred, Proj>)
+				{
+					if (!detail::__is_constant_evaluated()) {
+						return first + (detail::__find_char_set(first, last,
+							static_cast<const ext::char_set&>(pred)) - first);
+					}
 				}
+				for (; first != last; ++first) {
+					if (__stl2::invoke(pred, __stl2::invoke(proj, *first))) {
+						break;
+					}
+				}
+				return first;
 			}
-			return first;
 		}
 
 		template<InputRange R, class Proj = identity,
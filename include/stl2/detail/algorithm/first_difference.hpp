@@ -0,0 +1,135 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_FIRST_DIFFERENCE_HPP
+#define STL2_DETAIL_ALGORITHM_FIRST_DIFFERENCE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// Comparing contiguous ranges
+// The kernels of equal and lexicographical_compare over two contiguous
+// ranges of the same scalar type, compared by equal_to and less without
+// projections. Where equality is equality of object representations -
+// integers, std::byte, pointers - equal is memcmp; where order is also
+// the order of object representations as memcmp compares them - unsigned
+// bytes, and unsigned integers on big-endian targets - so is
+// lexicographical_compare. Other arithmetic types are scanned for the
+// first position at which the ranges differ, with AVX2 a vector at a
+// time.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class T>
+		META_CONCEPT __bitwise_equality = std::is_integral_v<T> ||
+			Same<T, std::byte> || std::is_pointer_v<T>;
+
+		template<class T>
+		META_CONCEPT __bitwise_order = (std::is_integral_v<T> &&
+			std::is_unsigned_v<T> && (sizeof(T) == 1 ||
+				__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)) ||
+			Same<T, std::byte>;
+
+		template<class T>
+		META_CONCEPT __first_difference_element =
+			(std::is_arithmetic_v<T> && sizeof(T) <= 8) || Same<T, std::byte> ||
+			std::is_pointer_v<T>;
+
+		// Two contiguous ranges of the same scalar type, seen through the
+		// identity projection.
+		template<class I1, class I2, class Proj1, class Proj2>
+		META_CONCEPT __comparable_contiguous =
+			std::is_pointer_v<I1> && std::is_pointer_v<I2> &&
+			Same<iter_value_t<I1>, iter_value_t<I2>> &&
+			(Same<iter_reference_t<I1>, iter_value_t<I1>&> ||
+			 Same<iter_reference_t<I1>, const iter_value_t<I1>&>) &&
+			(Same<iter_reference_t<I2>, iter_value_t<I2>&> ||
+			 Same<iter_reference_t<I2>, const iter_value_t<I2>&>) &&
+			__same_function_object<Proj1, identity> &&
+			__same_function_object<Proj2, identity>;
+
+		// The index of the first of the n elements of a and b that are
+		// not equal, or - if Equivalence - of which either is less, or n.
+		template<bool Equivalence, class T>
+		std::size_t __first_difference(const T* const a, const T* const b,
+			const std::size_t n) noexcept
+		{
+			std::size_t i = 0;
+#if defined(__AVX2__)
+			constexpr std::size_t lanes = 32 / sizeof(T);
+			for (; n - i >= lanes; i += lanes) {
+				const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+				const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+				__m256i same;
+				if constexpr (Same<T, float>) {
+					same = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(x),
+						_mm256_castsi256_ps(y), Equivalence ? _CMP_EQ_UQ : _CMP_EQ_OQ));
+				} else if constexpr (Same<T, double>) {
+					same = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(x),
+						_mm256_castsi256_pd(y), Equivalence ? _CMP_EQ_UQ : _CMP_EQ_OQ));
+				} else {
+					same = _mm256_cmpeq_epi8(x, y);
+				}
+				const auto m = ~static_cast<unsigned>(_mm256_movemask_epi8(same));
+				if (m) return i + __builtin_ctz(m) / sizeof(T);
+			}
+#endif
+			for (; i < n; ++i) {
+				if constexpr (Equivalence) {
+					if (a[i] < b[i] || b[i] < a[i]) break;
+				} else {
+					if (!(a[i] == b[i])) break;
+				}
+			}
+			return i;
+		}
+
+		// Are the n elements at a and b equal?
+		template<class T>
+		bool __equal_contiguous(const T* const a, const T* const b,
+			const std::size_t n) noexcept
+		{
+			if constexpr (__bitwise_equality<T>) {
+				return n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0;
+			} else {
+				return __first_difference<false>(a, b, n) == n;
+			}
+		}
+
+		// Does [a, a + n1) precede [b, b + n2) lexicographically?
+		template<class T>
+		bool __lexicographical_compare_contiguous(const T* const a,
+			const std::size_t n1, const T* const b, const std::size_t n2) noexcept
+		{
+			const std::size_t n = n1 < n2 ? n1 : n2;
+			if constexpr (__bitwise_order<T>) {
+				if (n != 0) {
+					if (const int r = std::memcmp(a, b, n * sizeof(T))) return r < 0;
+				}
+			} else {
+				const std::size_t i = __first_difference<true>(a, b, n);
+				if (i != n) return a[i] < b[i];
+			}
+			return n1 < n2;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -14,6 +14,8 @@
 
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -28,10 +30,25 @@ STL2_OPEN_NAMESPACE {
 			IndirectUnaryInvocable<projected<I, Proj>> F>
 		constexpr for_each_result<I, F>
 		operator()(I first, S last, F fun, Proj proj = {}) const {
-			for (; first != last; ++first) {
-				__stl2::invoke(fun, __stl2::invoke(proj, *first));
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				auto [uend, f] = (*this)(ufirst, std::move(ulast), std::move(fun),
+					__stl2::ref(proj));
+				return {ext::rewrap(std::move(first), ufirst, std::move(uend)),
+					std::move(f)};
+			} else if constexpr (ext::SegmentedSentinel<S, I>) {
+				auto end = detail::segmented_walk(std::move(first), last,
+					[&](auto lfirst, const auto& llast) {
+						(*this)(std::move(lfirst), llast, __stl2::ref(fun),
+							__stl2::ref(proj));
+					});
+				return {std::move(end), std::move(fun)};
+			} else {
+				for (; first != last; ++first) {
+					__stl2::invoke(fun, __stl2::invoke(proj, *first));
+				}
+				return {std::move(first), std::move(fun)};
 			}
-			return {std::move(first), std::move(fun)};
 		}
 
 		template<InputRange R, class Proj = identity,
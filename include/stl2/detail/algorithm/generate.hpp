@@ -13,6 +13,7 @@
 #define STL2_DETAIL_ALGORITHM_GENERATE_HPP
 
 #include <stl2/detail/concepts/function.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -23,10 +24,16 @@ STL2_OPEN_NAMESPACE {
 		template<Iterator O, Sentinel<O> S, CopyConstructible F>
 		requires Invocable<F&> && Writable<O, invoke_result_t<F&>>
 		constexpr O operator()(O first, S last, F gen) const {
-			for (; first != last; ++first) {
-				*first = gen();
+			if constexpr (ext::Unwrappable<O, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				return ext::rewrap(std::move(first), ufirst,
+					(*this)(ufirst, std::move(ulast), __stl2::ref(gen)));
+			} else {
+				for (; first != last; ++first) {
+					*first = gen();
+				}
+				return first;
 			}
-			return first;
 		}
 
 		template<class R, CopyConstructible F>
@@ -0,0 +1,95 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_HASH_DIFFERENCE_HPP
+#define STL2_DETAIL_ALGORITHM_HASH_DIFFERENCE_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash_index.hpp>
+#include <stl2/detail/algorithm/results.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/primitives.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// hash_difference [Extension]
+// Copies the elements of the first range whose keys - their projections -
+// are not matched by elements of the second range, as set_difference does,
+// but without requiring either range to be sorted: if a key occurs m times
+// in the first range and n times in the second, the last max(m - n, 0) of
+// its occurrences in the first range are copied. The output preserves the
+// order of the first range. Expected O(N1 + N2), using a hash index of the
+// second range. Keys of the first range are converted to the second
+// range's key type before they are hashed, unless they are known to hash
+// alike (see ext::enable_hash_lookup).
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I1, class O>
+		using hash_difference_result = __in_out_result<I1, O>;
+
+		struct __hash_difference_fn : private __niebloid {
+			template<InputIterator I1, Sentinel<I1> S1, ForwardIterator I2,
+				Sentinel<I2> S2, WeaklyIncrementable O, class Proj1 = identity,
+				class Proj2 = identity>
+			requires IndirectlyCopyable<I1, O> &&
+				detail::HashIndexable<I2, Proj2> &&
+				detail::HashIndexLookup<iter_value_t<projected<I1, Proj1>>,
+					iter_value_t<projected<I2, Proj2>>> &&
+				IndirectRelation<equal_to, projected<I1, Proj1>,
+					projected<I2, Proj2>>
+			hash_difference_result<I1, O>
+			operator()(I1 first1, S1 last1, I2 first2, S2 last2, O result,
+				Proj1 proj1 = {}, Proj2 proj2 = {}) const
+			{
+				auto index = detail::hash_index_count(first2, last2, proj2);
+				for (; first1 != last1; ++first1) {
+					iter_reference_t<I1>&& v1 = *first1;
+					auto&& key = __stl2::invoke(proj1, v1);
+					auto s = index.find(detail::hash_index_key_as<
+							iter_value_t<projected<I2, Proj2>>>(key),
+						[&](const I2& i) {
+							return __stl2::invoke(equal_to{}, key,
+								__stl2::invoke(proj2, *i));
+						});
+					if (s && s->count > 0) {
+						--s->count;
+					} else {
+						*result = std::forward<iter_reference_t<I1>>(v1);
+						++result;
+					}
+				}
+				return {std::move(first1), std::move(result)};
+			}
+
+			template<InputRange R1, ForwardRange R2, WeaklyIncrementable O,
+				class Proj1 = identity, class Proj2 = identity>
+			requires IndirectlyCopyable<iterator_t<R1>, O> &&
+				detail::HashIndexable<iterator_t<R2>, Proj2> &&
+				detail::HashIndexLookup<
+					iter_value_t<projected<iterator_t<R1>, Proj1>>,
+					iter_value_t<projected<iterator_t<R2>, Proj2>>> &&
+				IndirectRelation<equal_to, projected<iterator_t<R1>, Proj1>,
+					projected<iterator_t<R2>, Proj2>>
+			hash_difference_result<safe_iterator_t<R1>, O>
+			operator()(R1&& r1, R2&& r2, O result, Proj1 proj1 = {},
+				Proj2 proj2 = {}) const
+			{
+				return (*this)(begin(r1), end(r1), begin(r2), end(r2),
+					std::move(result), __stl2::ref(proj1), __stl2::ref(proj2));
+			}
+		};
+
+		inline constexpr __hash_difference_fn hash_difference {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
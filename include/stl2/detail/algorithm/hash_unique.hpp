@@ -0,0 +1,82 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_HASH_UNIQUE_HPP
+#define STL2_DETAIL_ALGORITHM_HASH_UNIQUE_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash_index.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/primitives.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// hash_unique [Extension]
+// Like unique, but removes every element whose key - its projection -
+// equals that of an earlier element, whether or not they are adjacent.
+// The first occurrence of each key is kept, and the kept elements keep
+// their relative order. Expected O(N), using a hash index of the kept
+// elements.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __hash_unique_fn : private __niebloid {
+			template<Permutable I, Sentinel<I> S, class Proj = identity>
+			requires detail::HashIndexable<I, Proj>
+			I operator()(I first, S last, Proj proj = {}) const {
+				std::size_t n = 0;
+				if constexpr (SizedSentinel<S, I>) {
+					n = static_cast<std::size_t>(last - first);
+				}
+				return impl(std::move(first), std::move(last), proj, n);
+			}
+
+			template<ForwardRange R, class Proj = identity>
+			requires Permutable<iterator_t<R>> &&
+				detail::HashIndexable<iterator_t<R>, Proj>
+			safe_iterator_t<R> operator()(R&& r, Proj proj = {}) const {
+				std::size_t n = 0;
+				if constexpr (SizedRange<R>) {
+					n = static_cast<std::size_t>(__stl2::size(r));
+				}
+				return impl(begin(r), end(r), proj, n);
+			}
+
+		private:
+			template<class I, class S, class Proj>
+			static I impl(I first, S last, Proj& proj, std::size_t n) {
+				detail::hash_index<I> index{n};
+				auto result = first;
+				for (; first != last; ++first) {
+					auto&& key = __stl2::invoke(proj, *first);
+					// Kept elements are indexed at their final positions.
+					auto [s, inserted] = index.insert(detail::hash_index_key(key),
+						result, [&](const I& i) {
+							return __stl2::invoke(equal_to{}, key,
+								__stl2::invoke(proj, *i));
+						});
+					(void)s;
+					if (!inserted) continue;
+					if (result != first) {
+						*result = iter_move(first);
+					}
+					++result;
+				}
+				return result;
+			}
+		};
+
+		inline constexpr __hash_unique_fn hash_unique {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
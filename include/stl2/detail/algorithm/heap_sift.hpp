@@ -22,6 +22,7 @@
 #ifndef STL2_DETAIL_ALGORITHM_HEAP_SIFT_HPP
 #define STL2_DETAIL_ALGORITHM_HEAP_SIFT_HPP
 
+#include <cstddef>
 #include <stl2/detail/concepts/callable.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -30,6 +31,11 @@
 //
 STL2_OPEN_NAMESPACE {
 	namespace detail {
+		// Arity is the branching factor of the heap: the children of the node
+		// at offset i are at offsets Arity * i + 1 through Arity * i + Arity.
+		// The standard heap algorithms all use binary heaps.
+		template<std::size_t Arity = 2>
+		requires (Arity >= 2)
 		struct __sift_up_n_fn {
 			template<RandomAccessIterator I, class Comp, class Proj>
 			requires Sortable<I, Comp, Proj>
@@ -44,8 +50,9 @@ STL2_OPEN_NAMESPACE {
 						__stl2::invoke(proj, static_cast<decltype(rhs)>(rhs)));
 				};
 
+				constexpr auto d = static_cast<iter_difference_t<I>>(Arity);
 				I last = first + n;
-				n = (n - 2) / 2;
+				n = (n - 2) / d;
 				I i = first + n;
 				if (!pred(*i, *--last)) return;
 
@@ -54,7 +61,7 @@ STL2_OPEN_NAMESPACE {
 					*last = iter_move(i);
 					last = i;
 					if (n == 0) break;
-					n = (n - 1) / 2;
+					n = (n - 1) / d;
 					i = first + n;
 				} while(pred(*i, v));
 
@@ -62,19 +69,22 @@ STL2_OPEN_NAMESPACE {
 			}
 		};
 
-		inline constexpr __sift_up_n_fn sift_up_n {};
+		inline constexpr __sift_up_n_fn<> sift_up_n {};
 
+		template<std::size_t Arity = 2>
+		requires (Arity >= 2)
 		struct __sift_down_n_fn {
 			template<RandomAccessIterator I, class Comp, class Proj>
 			requires Sortable<I, Comp, Proj>
 			constexpr void operator()(I first, iter_difference_t<I> n, I start,
 				Comp comp, Proj proj) const
 			{
-				// left-child of start is at 2 * start + 1
-				// right-child of start is at 2 * start + 2
+				// first child of start is at Arity * start + 1
+				// last child of start is at Arity * start + Arity
+				constexpr auto d = static_cast<iter_difference_t<I>>(Arity);
 				auto child = start - first;
 
-				if (n < 2 || (n - 2) / 2 < child) return;
+				if (n < 2 || (n - 2) / d < child) return;
 
 				auto pred = [&](auto&& lhs, auto&& rhs) -> bool {
 					return __stl2::invoke(comp,
@@ -82,14 +92,22 @@ STL2_OPEN_NAMESPACE {
 						__stl2::invoke(proj, static_cast<decltype(rhs)>(rhs)));
 				};
 
-				child = 2 * child + 1;
-				I child_i = first + child;
+				// move child to the greatest child of the node at child
+				I child_i = first;
+				auto greatest_child = [&] {
+					child = d * child + 1;
+					child_i = first + child;
+					const auto last = n - child < d ? n : child + d;
+					for (auto c = child + 1; c < last; ++c) {
+						if (pred(*child_i, *(first + c))) {
+							// sibling c exists and is greater than child
+							child_i = first + c;
+							child = c;
+						}
+					}
+				};
 
-				if ((child + 1) < n && pred(*child_i, *(child_i + 1))) {
-					// right-child exists and is greater than left-child
-					++child_i;
-					++child;
-				}
+				greatest_child();
 
 				// check if we are in heap-order
 				if (pred(*child_i, *start)) {
@@ -103,17 +121,10 @@ STL2_OPEN_NAMESPACE {
 					*start = iter_move(child_i);
 					start = child_i;
 
-					if ((n - 2) / 2 < child) break;
+					if ((n - 2) / d < child) break;
 
 					// recompute the child based off of the updated parent
-					child = 2 * child + 1;
-					child_i = first + child;
-
-					if ((child + 1) < n && pred(*child_i, *(child_i + 1))) {
-						// right-child exists and is greater than left-child
-						++child_i;
-						++child;
-					}
+					greatest_child();
 
 					// check if we are in heap-order
 				} while (!pred(*child_i, top));
@@ -122,7 +133,7 @@ STL2_OPEN_NAMESPACE {
 			}
 		};
 
-		inline constexpr __sift_down_n_fn sift_down_n {};
+		inline constexpr __sift_down_n_fn<> sift_down_n {};
 	}
 } STL2_CLOSE_NAMESPACE
 
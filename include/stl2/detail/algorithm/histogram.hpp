@@ -0,0 +1,135 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_HISTOGRAM_HPP
+#define STL2_DETAIL_ALGORITHM_HISTOGRAM_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// histogram [Extension]
+// The number of elements of [first, last) whose projection is each of the
+// integers - or enumerators - 0 through bins - 1, as a vector of bins
+// counts. Runs of equal keys would make each increment wait on the store
+// of the one before it, so when the input is long enough to pay for them
+// the counts are kept in several sub-histograms, used in rotation, and
+// summed at the end.
+//
+// Precondition: every projected key k satisfies 0 <= k < bins.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class K>
+		META_CONCEPT __histogram_key = std::is_integral_v<K> || std::is_enum_v<K>;
+
+		template<__histogram_key K>
+		constexpr std::size_t __histogram_index(K k) noexcept {
+			if constexpr (std::is_enum_v<K>) {
+				return static_cast<std::size_t>(
+					static_cast<std::underlying_type_t<K>>(k));
+			} else {
+				return static_cast<std::size_t>(k);
+			}
+		}
+
+		inline constexpr std::size_t __count_ways = 4;
+
+		// Are the keys of [first, last) worth counting into __count_ways
+		// sub-histograms of bins counts each, rather than into one?
+		template<InputIterator I, Sentinel<I> S>
+		bool __split_counts(const I& first, const S& last, std::size_t bins) {
+			bool split = bins <= 4096;
+			if constexpr (SizedSentinel<S, I>) {
+				split = split &&
+					static_cast<std::size_t>(last - first) >= __count_ways * bins;
+			}
+			return split;
+		}
+
+		// Count key(*i), which must be less than bins, for each i in
+		// [first, last) into the zeroed counts at c: bins of them, or
+		// __count_ways * bins if split. The totals end up in the first
+		// bins.
+		template<class D, InputIterator I, Sentinel<I> S, class Key>
+		void __count_keys_into(D* const c, bool split, I first, S last,
+			std::size_t bins, Key key)
+		{
+			if (!split) {
+				for (; first != last; ++first) {
+					const std::size_t k = key(*first);
+					STL2_EXPECT(k < bins);
+					++c[k];
+				}
+				return;
+			}
+
+			auto count = [&](D* sub) {
+				const std::size_t k = key(*first);
+				STL2_EXPECT(k < bins);
+				++sub[k];
+				return ++first != last;
+			};
+			while (first != last && count(c) && count(c + bins) &&
+				count(c + 2 * bins) && count(c + 3 * bins)) {}
+			for (std::size_t b = 0; b < bins; ++b) {
+				c[b] += c[bins + b] + c[2 * bins + b] + c[3 * bins + b];
+			}
+		}
+
+		template<class D, InputIterator I, Sentinel<I> S, class Key>
+		std::vector<D> __count_keys(I first, S last, std::size_t bins, Key key) {
+			const bool split = __split_counts(first, last, bins);
+			std::vector<D> counts(split ? __count_ways * bins : bins);
+			__count_keys_into(counts.data(), split, std::move(first),
+				std::move(last), bins, std::move(key));
+			counts.resize(bins);
+			return counts;
+		}
+	}
+
+	namespace ext {
+		struct __histogram_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, class Proj = identity>
+			requires detail::__histogram_key<
+				__uncvref<indirect_result_t<Proj&, I>>>
+			std::vector<iter_difference_t<I>>
+			operator()(I first, S last, std::size_t bins, Proj proj = {}) const {
+				return detail::__count_keys<iter_difference_t<I>>(std::move(first),
+					std::move(last), bins, [&proj](auto&& x) {
+						return detail::__histogram_index(__stl2::invoke(proj,
+							static_cast<decltype(x)>(x)));
+					});
+			}
+
+			template<InputRange R, class Proj = identity>
+			requires detail::__histogram_key<
+				__uncvref<indirect_result_t<Proj&, iterator_t<R>>>>
+			std::vector<iter_difference_t<iterator_t<R>>>
+			operator()(R&& r, std::size_t bins, Proj proj = {}) const {
+				return (*this)(__stl2::begin(r), __stl2::end(r), bins,
+					__stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __histogram_fn histogram {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -14,10 +14,15 @@
 #define STL2_DETAIL_ALGORITHM_IS_PERMUTATION_HPP
 
 #include <limits>
+#include <unordered_map>
+#include <vector>
 
+#include <stl2/functional.hpp>
+#include <stl2/detail/hash.hpp>
 #include <stl2/detail/algorithm/count_if.hpp>
 #include <stl2/detail/algorithm/find_if.hpp>
 #include <stl2/detail/algorithm/mismatch.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
 #include <stl2/detail/iterator/counted_iterator.hpp>
 #include <stl2/detail/iterator/unreachable.hpp>
 #include <stl2/detail/range/primitives.hpp>
@@ -26,6 +31,15 @@
 // is_permutation [alg.is_permutation]
 //
 STL2_OPEN_NAMESPACE {
+	// The projected elements of both sequences have the same value type, and
+	// pred is equal_to, so the elements can be compared as copies.
+	template<class I1, class I2, class Pred, class Proj1, class Proj2>
+	META_CONCEPT __is_permutation_by_value =
+		__same_function_object<Pred, equal_to> &&
+		Same<iter_value_t<projected<I1, Proj1>>,
+			iter_value_t<projected<I2, Proj2>>> &&
+		Copyable<iter_value_t<projected<I1, Proj1>>>;
+
 	struct __is_permutation_fn : private __niebloid {
 		template<ForwardIterator I1, Sentinel<I1> S1, ForwardIterator I2,
 			Sentinel<I2> S2, class Pred = equal_to, class Proj1 = identity,
@@ -180,6 +194,19 @@ STL2_OPEN_NAMESPACE {
 			STL2_ASSERT(!__stl2::invoke(pred, __stl2::invoke(proj1, *first1), __stl2::invoke(proj2, *first2)));
 			if (n == 1) return false;
 
+			if constexpr (__is_permutation_by_value<I1, I2, Pred, Proj1, Proj2>) {
+				using V = iter_value_t<projected<I1, Proj1>>;
+				if (n > __by_value_threshold) {
+					if constexpr (ext::Hashable<V>) {
+						return __is_permutation_hash<V>(first1, first2, n,
+							proj1, proj2);
+					} else if constexpr (StrictTotallyOrdered<V>) {
+						return __is_permutation_sort<V>(first1, first2, n,
+							proj1, proj2);
+					}
+				}
+			}
+
 			// For each element in [first1, n), see if there are the same number of
 			// equal elements in [first2, n)
 			counted_iterator<I1> i{first1, n};
@@ -212,6 +239,47 @@ STL2_OPEN_NAMESPACE {
 			return true;
 		}
 
+		// Below this length the quadratic algorithm beats allocating.
+		static constexpr int __by_value_threshold = 16;
+
+		// Count the elements of [first1, n) in a hash map, then check off the
+		// elements of [first2, n) against the counts: expected O(n).
+		template<class V, ForwardIterator I1, ForwardIterator I2,
+			class Proj1, class Proj2>
+		static bool __is_permutation_hash(I1 first1, I2 first2,
+			const iter_difference_t<I1> n, Proj1& proj1, Proj2& proj2)
+		{
+			std::unordered_map<V, iter_difference_t<I1>, __hash::__fn> counts;
+			counts.reserve(static_cast<std::size_t>(n));
+			for (auto i = n; i > 0; --i, ++first1) {
+				++counts[__stl2::invoke(proj1, *first1)];
+			}
+			for (auto i = n; i > 0; --i, ++first2) {
+				auto pos = counts.find(__stl2::invoke(proj2, *first2));
+				if (pos == counts.end() || pos->second == 0) return false;
+				--pos->second;
+			}
+			return true;
+		}
+
+		// Sort copies of both sequences and compare them: O(n log n).
+		template<class V, ForwardIterator I1, ForwardIterator I2,
+			class Proj1, class Proj2>
+		static bool __is_permutation_sort(I1 first1, I2 first2,
+			const iter_difference_t<I1> n, Proj1& proj1, Proj2& proj2)
+		{
+			std::vector<V> v1, v2;
+			v1.reserve(static_cast<std::size_t>(n));
+			v2.reserve(static_cast<std::size_t>(n));
+			for (auto i = n; i > 0; --i, ++first1, ++first2) {
+				v1.push_back(__stl2::invoke(proj1, *first1));
+				v2.push_back(__stl2::invoke(proj2, *first2));
+			}
+			sort(v1);
+			sort(v2);
+			return v1 == v2;
+		}
+
 		template<ForwardIterator I1, ForwardIterator I2,
 			class Pred, class Proj1, class Proj2>
 		requires IndirectlyComparable<I1, I2, Pred, Proj1, Proj2>
@@ -13,6 +13,7 @@
 #define STL2_DETAIL_ALGORITHM_IS_SORTED_UNTIL_HPP
 
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -24,17 +25,24 @@ STL2_OPEN_NAMESPACE {
 			IndirectStrictWeakOrder<projected<I, Proj>> Comp = less>
 		constexpr I
 		operator()(I first, S last, Comp comp = {}, Proj proj = {}) const {
-			if (first != last) {
-				while (true) {
-					auto prev = first;
-					if (++first == last || __stl2::invoke(comp,
-							__stl2::invoke(proj, *first),
-							__stl2::invoke(proj, *prev))) {
-						break;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				return ext::rewrap(std::move(first), ufirst,
+					(*this)(ufirst, std::move(ulast), __stl2::ref(comp),
+						__stl2::ref(proj)));
+			} else {
+				if (first != last) {
+					while (true) {
+						auto prev = first;
+						if (++first == last || __stl2::invoke(comp,
+								__stl2::invoke(proj, *first),
+								__stl2::invoke(proj, *prev))) {
+							break;
+						}
 					}
 				}
+				return first;
 			}
-			return first;
 		}
 
 		template<ForwardRange R, class Proj = identity,
@@ -12,11 +12,15 @@
 #ifndef STL2_DETAIL_ALGORITHM_LEXICOGRAPHICAL_COMPARE_HPP
 #define STL2_DETAIL_ALGORITHM_LEXICOGRAPHICAL_COMPARE_HPP
 
+#include <stl2/detail/algorithm/first_difference.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/concepts.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // lexicographical_compare [alg.lex.comparison]
+// Contiguous ranges of scalars ordered by less are compared by memcmp or
+// a vectorized scan; see first_difference.hpp.
 //
 STL2_OPEN_NAMESPACE {
 	struct __lexicographical_compare_fn : private __niebloid {
@@ -27,25 +31,44 @@ STL2_OPEN_NAMESPACE {
 		constexpr bool operator()(I1 first1, S1 last1, I2 first2, S2 last2,
 			Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const
 		{
-			while (true) {
-				const bool at_end2 = first2 == last2;
+			if constexpr (ext::Unwrappable<I1, S1> || ext::Unwrappable<I2, S2>) {
+				auto [ufirst1, ulast1] = ext::unwrap(std::move(first1), std::move(last1));
+				auto [ufirst2, ulast2] = ext::unwrap(std::move(first2), std::move(last2));
+				return (*this)(std::move(ufirst1), std::move(ulast1),
+					std::move(ufirst2), std::move(ulast2), __stl2::ref(comp),
+					__stl2::ref(proj1), __stl2::ref(proj2));
+			} else {
+				if constexpr (detail::__comparable_contiguous<I1, I2, Proj1, Proj2> &&
+					Same<I1, S1> && Same<I2, S2> &&
+					detail::__first_difference_element<iter_value_t<I1>> &&
+					__same_function_object<Comp, less>)
+				{
+					if (!detail::__is_constant_evaluated()) {
+						return detail::__lexicographical_compare_contiguous<iter_value_t<I1>>(
+							first1, static_cast<std::size_t>(last1 - first1),
+							first2, static_cast<std::size_t>(last2 - first2));
+					}
+				}
+				while (true) {
+					const bool at_end2 = first2 == last2;
 
-				if (first1 == last1) return !at_end2;
-				if (at_end2) return false;
+					if (first1 == last1) return !at_end2;
+					if (at_end2) return false;
 
-				if (__stl2::invoke(comp,
-						__stl2::invoke(proj1, *first1),
-						__stl2::invoke(proj2, *first2))) {
-					return true;
-				}
-				if (__stl2::invoke(comp,
-						__stl2::invoke(proj2, *first2),
-						__stl2::invoke(proj1, *first1))) {
-					return false;
-				}
+					if (__stl2::invoke(comp,
+							__stl2::invoke(proj1, *first1),
+							__stl2::invoke(proj2, *first2))) {
+						return true;
+					}
+					if (__stl2::invoke(comp,
+							__stl2::invoke(proj2, *first2),
+							__stl2::invoke(proj1, *first1))) {
+						return false;
+					}
 
-				++first1;
-				++first2;
+					++first1;
+					++first2;
+				}
 			}
 		}
 
@@ -0,0 +1,227 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_MERGE_K_HPP
+#define STL2_DETAIL_ALGORITHM_MERGE_K_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// merge_k [Extension]
+// Merge any number of sorted runs - the elements of a range of ranges, as
+// accepted by join_view - into one sorted sequence. A tournament tree of
+// losers over the heads of the runs picks each output element with about
+// log2(k) comparisons, replaying only the path from the winner's leaf to
+// the root, and each element is copied once, straight to the output.
+// Pairwise merging instead copies every element log2(k) times. The merge
+// is stable: equivalent elements keep the order of their runs.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class R>
+		META_CONCEPT __mergeable_runs = ForwardRange<R> &&
+			InputRange<iter_reference_t<iterator_t<R>>> &&
+			_ForwardingRange<iter_reference_t<iterator_t<R>>>;
+
+		template<class R>
+		using __run_iterator_t = iterator_t<iter_reference_t<iterator_t<R>>>;
+
+		// A loser tree over k runs [first, last). Internal node n in [1, k)
+		// holds the loser of the match between its children 2n and 2n+1;
+		// node k + i is the leaf for run i; node 0 holds the overall winner.
+		// Ties go to the earlier run, so the merge is stable. A run that
+		// runs out keeps its leaf, which then holds a sentinel that loses
+		// every match.
+		//
+		// When Key is not void, each node caches the projected key of its
+		// run's head, so matches compare nodes without touching the runs.
+		template<InputIterator I, Sentinel<I> S, class Key = void>
+		class loser_tree {
+			static constexpr bool cached = !Same<Key, void>;
+
+			struct run {
+				I first;
+				S last;
+			};
+			struct keyed_node {
+				Key key;
+				std::size_t run;
+			};
+			struct plain_node {
+				std::size_t run;
+			};
+			using node = meta::if_c<cached, keyed_node, plain_node>;
+
+			static constexpr std::size_t exhausted = std::size_t(-1);
+
+			std::vector<run> runs_;
+			std::vector<node> tree_;
+			// The number of runs not yet exhausted.
+			std::size_t live_ = 0;
+
+		public:
+			loser_tree() = default;
+
+			// Add a run before build; empty runs are dropped.
+			void push(I first, S last) {
+				if (first != last) {
+					runs_.push_back(run{std::move(first), std::move(last)});
+				}
+			}
+
+			template<class Comp, class Proj>
+			void build(Comp& comp, Proj& proj) {
+				tree_.clear();
+				live_ = runs_.size();
+				if (!runs_.empty()) {
+					tree_.resize(runs_.size(), make_node(0, proj));
+					tree_[0] = build(1, comp, proj);
+				}
+			}
+
+			bool empty() const {
+				return live_ == 0;
+			}
+
+			// The head of the winning run. Precondition: !empty()
+			I& top() {
+				return runs_[tree_[0].run].first;
+			}
+
+			// Advance the winning run and replay its matches.
+			// Precondition: !empty()
+			template<class Comp, class Proj>
+			void pop(Comp& comp, Proj& proj) {
+				tree_[0].run = next(tree_[0].run, comp, proj);
+			}
+
+			// Pass the head of each run to f, in merged order, until all of
+			// the runs are exhausted. Keeps the winner out of memory that f
+			// might write.
+			template<class F, class Comp, class Proj>
+			void drain(F f, Comp& comp, Proj& proj) {
+				if (live_ == 0) return;
+				std::size_t i = tree_[0].run;
+				do {
+					f(runs_[i].first);
+					i = next(i, comp, proj);
+				} while (live_ != 0);
+			}
+
+		private:
+			// Advance run i, the winner, and replay its matches; returns the
+			// index of the new winner, which is exhausted if all the runs are.
+			template<class Comp, class Proj>
+			std::size_t next(std::size_t i, Comp& comp, Proj& proj) {
+				auto& r = runs_[i];
+				const bool done = ++r.first == r.last;
+				// The root's stale key is as good as any for a sentinel.
+				node winner = done ? tree_[0] : make_node(i, proj);
+				if (done) {
+					winner.run = exhausted;
+					--live_;
+				}
+				for (std::size_t n = (i + runs_.size()) / 2; n > 0; n /= 2) {
+					if (beats(tree_[n], winner, comp, proj)) {
+						std::swap(tree_[n], winner);
+					}
+				}
+				return winner.run;
+			}
+
+			template<class Proj>
+			node make_node(std::size_t i, Proj& proj) {
+				if constexpr (cached) {
+					return node{Key(__stl2::invoke(proj, *runs_[i].first)), i};
+				} else {
+					return node{i};
+				}
+			}
+
+			template<class Comp, class Proj>
+			bool beats(const node& a, const node& b, Comp& comp, Proj& proj) {
+				if (b.run == exhausted) return a.run != exhausted;
+				if (a.run == exhausted) return false;
+				auto match = [&](auto&& x, auto&& y) {
+					// The earlier run wins ties. Ties are rare, so test for one
+					// last to keep the branches predictable.
+					return __stl2::invoke(comp, x, y) ||
+						(!__stl2::invoke(comp, y, x) && a.run < b.run);
+				};
+				if constexpr (cached) {
+					return match(a.key, b.key);
+				} else {
+					return match(__stl2::invoke(proj, *runs_[a.run].first),
+						__stl2::invoke(proj, *runs_[b.run].first));
+				}
+			}
+
+			// Play the matches of the subtree rooted at node n; returns its
+			// winner.
+			template<class Comp, class Proj>
+			node build(std::size_t n, Comp& comp, Proj& proj) {
+				const std::size_t k = runs_.size();
+				if (n >= k) return make_node(n - k, proj);
+				node a = build(2 * n, comp, proj);
+				node b = build(2 * n + 1, comp, proj);
+				if (beats(b, a, comp, proj)) {
+					std::swap(a, b);
+				}
+				tree_[n] = std::move(b);
+				return a;
+			}
+		};
+
+		// Cache keys in the tree when they are cheap to copy.
+		template<class I, class S, class Proj,
+			class Key = __uncvref<invoke_result_t<Proj&, iter_reference_t<I>>>>
+		using __loser_tree_for = loser_tree<I, S,
+			meta::if_c<std::is_trivially_copyable_v<Key> &&
+				sizeof(Key) <= 2 * sizeof(void*) &&
+				Constructible<Key, invoke_result_t<Proj&, iter_reference_t<I>>>,
+				Key, void>>;
+	}
+
+	namespace ext {
+		struct __merge_k_fn : private __niebloid {
+			template<InputRange R, WeaklyIncrementable O, class Comp = less,
+				class Proj = identity>
+			requires detail::__mergeable_runs<R> &&
+				Mergeable<detail::__run_iterator_t<R>, detail::__run_iterator_t<R>,
+					O, Comp, Proj, Proj>
+			O operator()(R&& runs, O result, Comp comp = {}, Proj proj = {}) const {
+				using Run = iter_reference_t<iterator_t<R>>;
+				detail::__loser_tree_for<iterator_t<Run>, sentinel_t<Run>, Proj> tree;
+				for (auto&& r : runs) {
+					tree.push(__stl2::begin(r), __stl2::end(r));
+				}
+				tree.build(comp, proj);
+				tree.drain([&result](auto& i) {
+					*result = *i;
+					++result;
+				}, comp, proj);
+				return result;
+			}
+		};
+
+		inline constexpr __merge_k_fn merge_k {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
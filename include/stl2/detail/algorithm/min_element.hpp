@@ -12,7 +12,9 @@
 #ifndef STL2_DETAIL_ALGORITHM_MIN_ELEMENT_HPP
 #define STL2_DETAIL_ALGORITHM_MIN_ELEMENT_HPP
 
+#include <stl2/detail/algorithm/extremum.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -24,16 +26,29 @@ STL2_OPEN_NAMESPACE {
 			IndirectStrictWeakOrder<projected<I, Proj>> Comp = less>
 		constexpr I
 		operator()(I first, S last, Comp comp = {}, Proj proj = {}) const {
-			if (first != last) {
-				for (auto i = next(first); i != last; ++i) {
-					if (__stl2::invoke(comp,
-							__stl2::invoke(proj, *i),
-							__stl2::invoke(proj, *first))) {
-						first = i;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				return ext::rewrap(std::move(first), ufirst,
+					(*this)(ufirst, std::move(ulast), __stl2::ref(comp),
+						__stl2::ref(proj)));
+			} else {
+				if constexpr (detail::__simd_extremum<I, S, Comp, Proj>) {
+					if (first != last && !detail::__is_constant_evaluated()) {
+						return first + (detail::__simd_extremum_positions<
+							true, false, false>(first, last).min - first);
 					}
 				}
+				if (first != last) {
+					for (auto i = next(first); i != last; ++i) {
+						if (__stl2::invoke(comp,
+								__stl2::invoke(proj, *i),
+								__stl2::invoke(proj, *first))) {
+							first = i;
+						}
+					}
+				}
+				return first;
 			}
-			return first;
 		}
 
 		template<ForwardRange R, class Proj = identity,
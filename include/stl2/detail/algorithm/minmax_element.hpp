@@ -16,8 +16,10 @@
 #ifndef STL2_DETAIL_ALGORITHM_MINMAX_ELEMENT_HPP
 #define STL2_DETAIL_ALGORITHM_MINMAX_ELEMENT_HPP
 
+#include <stl2/detail/algorithm/extremum.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/dangling.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -30,33 +32,48 @@ STL2_OPEN_NAMESPACE {
 		constexpr minmax_result<I>
 		operator()(I first, S last, Comp comp = {}, Proj proj = {}) const
 		{
-			minmax_result<I> result{first, first};
-			if (first == last || ++first == last) return result;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				auto [umin, umax] = (*this)(ufirst, std::move(ulast),
+					__stl2::ref(comp), __stl2::ref(proj));
+				return {ext::rewrap(first, ufirst, std::move(umin)),
+					ext::rewrap(first, ufirst, std::move(umax))};
+			} else {
+				if constexpr (detail::__simd_extremum<I, S, Comp, Proj>) {
+					if (first != last && !detail::__is_constant_evaluated()) {
+						const auto r = detail::__simd_extremum_positions<
+							true, true, true>(first, last);
+						return {first + (r.min - first), first + (r.max - first)};
+					}
+				}
+				minmax_result<I> result{first, first};
+				if (first == last || ++first == last) return result;
 
-			auto pred = [&](auto&& lhs, auto&& rhs) -> bool {
-				return __stl2::invoke(comp,
-					__stl2::invoke(proj, static_cast<decltype(lhs)>(lhs)),
-					__stl2::invoke(proj, static_cast<decltype(rhs)>(rhs)));
-			};
-			if (pred(*first, *result.max)) result.min = first;
-			else result.max = first;
+				auto pred = [&](auto&& lhs, auto&& rhs) -> bool {
+					return __stl2::invoke(comp,
+						__stl2::invoke(proj, static_cast<decltype(lhs)>(lhs)),
+						__stl2::invoke(proj, static_cast<decltype(rhs)>(rhs)));
+				};
+				if (pred(*first, *result.max)) result.min = first;
+				else result.max = first;
 
-			while (true) {
-				if (++first == last) return result;
+				while (true) {
+					if (++first == last) return result;
 
-				I tmp = first;
-				if (++first == last) {
-					if (pred(*tmp, *result.min)) result.min = tmp;
-					else if (!pred(*tmp, *result.max)) result.max = tmp;
-					return result;
-				}
+					I tmp = first;
+					if (++first == last) {
+						if (pred(*tmp, *result.min)) result.min = tmp;
+						else if (!pred(*tmp, *result.max)) result.max = tmp;
+						return result;
+					}
 
-				if (pred(*first, *tmp)) {
-					if (pred(*first, *result.min)) result.min = first;
-					if (!pred(*tmp, *result.max)) result.max = tmp;
-				} else {
-					if (pred(*tmp, *result.min)) result.min = tmp;
-					if (!pred(*first, *result.max)) result.max = first;
+					if (pred(*first, *tmp)) {
+						if (pred(*first, *result.min)) result.min = first;
+						if (!pred(*tmp, *result.max)) result.max = tmp;
+					} else {
+						if (pred(*tmp, *result.min)) result.min = tmp;
+						if (!pred(*first, *result.max)) result.max = first;
+					}
 				}
 			}
 		}
@@ -14,6 +14,7 @@
 
 #include <stl2/detail/algorithm/copy.hpp>
 #include <stl2/detail/algorithm/results.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -28,10 +29,17 @@ STL2_OPEN_NAMESPACE {
 		requires IndirectlyMovable<I, O>
 		constexpr move_result<I, O>
 		operator()(I first, S last, O result) const {
-			for (; first != last; (void) ++first, (void) ++result) {
-				*result = iter_move(first);
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				auto [uend, out] = (*this)(ufirst, std::move(ulast), std::move(result));
+				return {ext::rewrap(std::move(first), ufirst, std::move(uend)),
+					std::move(out)};
+			} else {
+				for (; first != last; (void) ++first, (void) ++result) {
+					*result = iter_move(first);
+				}
+				return {std::move(first), std::move(result)};
 			}
-			return {std::move(first), std::move(result)};
 		}
 
 		template<InputRange R, WeaklyIncrementable O>
@@ -50,10 +58,17 @@ STL2_OPEN_NAMESPACE {
 			requires IndirectlyMovable<I, O>
 			constexpr move_result<I, O>
 			operator()(I first, S last, O result) const {
-				for (; first != last; (void) ++first, (void) ++result) {
-					*result = iter_move(first);
+				if constexpr (ext::Unwrappable<I, S>) {
+					auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+					auto [uend, out] = (*this)(ufirst, std::move(ulast), std::move(result));
+					return {ext::rewrap(std::move(first), ufirst, std::move(uend)),
+						std::move(out)};
+				} else {
+					for (; first != last; (void) ++first, (void) ++result) {
+						*result = iter_move(first);
+					}
+					return {std::move(first), std::move(result)};
 				}
-				return {std::move(first), std::move(result)};
 			}
 
 			template<InputRange R, class O>
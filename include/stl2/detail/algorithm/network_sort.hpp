@@ -0,0 +1,56 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_NETWORK_SORT_HPP
+#define STL2_DETAIL_ALGORITHM_NETWORK_SORT_HPP
+
+#include <cstddef>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/span.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/sorting_network.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/dangling.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// network_sort [Extension]
+// Sort a range whose size is part of its type - an array, std::array or
+// a span of static extent - with the sorting network for that size, fully
+// unrolled: no loops and, for small trivially copyable elements, no
+// data-dependent branches. Ranges of more than 32 elements are sorted
+// with sort.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __network_sort_fn : private __niebloid {
+			template<RandomAccessRange R, class Comp = less, class Proj = identity>
+			requires __span::has_static_extent<R> &&
+				Sortable<iterator_t<R>, Comp, Proj>
+			constexpr safe_iterator_t<R>
+			operator()(R&& r, Comp comp = {}, Proj proj = {}) const {
+				constexpr auto n = static_cast<std::size_t>(__span::static_extent<R>::value);
+				if constexpr (n <= detail::__max_network) {
+					detail::network_sort<n>(__stl2::begin(r), comp, proj);
+					return __stl2::end(r);
+				} else {
+					return __stl2::sort(r, __stl2::ref(comp), __stl2::ref(proj));
+				}
+			}
+		};
+
+		inline constexpr __network_sort_fn network_sort {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -23,6 +23,7 @@
 #define STL2_DETAIL_ALGORITHM_NTH_ELEMENT_HPP
 
 #include <stl2/detail/algorithm/min_element.hpp>
+#include <stl2/detail/algorithm/sorting_network.hpp>
 #include <stl2/detail/concepts/callable.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
@@ -40,6 +41,8 @@ STL2_OPEN_NAMESPACE {
 		{
 			constexpr iter_difference_t<I> limit = 7;
 			static_assert(limit >= 3);
+			// Small values are sorted outright by network below this.
+			constexpr iter_difference_t<I> network_limit = 16;
 
 			auto pred = [&](auto&& lhs, auto&& rhs) -> bool {
 				return __stl2::invoke(comp,
@@ -54,6 +57,12 @@ STL2_OPEN_NAMESPACE {
 
 				iter_difference_t<I> len = end - first;
 				STL2_EXPECT(len >= 0);
+				if constexpr (detail::__branchless_network<I>) {
+					if (len <= network_limit) {
+						detail::network_sort_n<network_limit>(first, len, comp, proj);
+						return end_orig;
+					}
+				}
 				switch (len) {
 				case 0:
 				case 1:
@@ -12,12 +12,16 @@
 #ifndef STL2_DETAIL_ALGORITHM_PARTITION_COPY_HPP
 #define STL2_DETAIL_ALGORITHM_PARTITION_COPY_HPP
 
+#include <stl2/detail/algorithm/compress.hpp>
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // partition_copy [alg.partitions]
+// Contiguous ranges of small trivially copyable values are partitioned
+// without branching on the predicate; see compress.hpp.
 //
 STL2_OPEN_NAMESPACE {
 	template<class I, class O1, class O2>
@@ -32,17 +36,37 @@ STL2_OPEN_NAMESPACE {
 		operator()(I first, S last, O1 out_true, O2 out_false, Pred pred,
 			Proj proj = {}) const
 		{
-			for (; first != last; ++first) {
-				iter_reference_t<I>&& v = *first;
-				if (__stl2::invoke(pred, __stl2::invoke(proj, v))) {
-					*out_true  = std::forward<iter_reference_t<I>>(v);
-					++out_true;
-				} else {
-					*out_false = std::forward<iter_reference_t<I>>(v);
-					++out_false;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				auto [upos, t, f] = (*this)(ufirst, std::move(ulast),
+					std::move(out_true), std::move(out_false),
+					__stl2::ref(pred), __stl2::ref(proj));
+				return {ext::rewrap(std::move(first), ufirst, std::move(upos)),
+					std::move(t), std::move(f)};
+			} else {
+				if constexpr (detail::__compressible<I, S> &&
+					detail::__nothrow_compress_predicate<iter_reference_t<I>,
+						Pred, Proj>)
+				{
+					if (!detail::__is_constant_evaluated()) {
+						detail::__compress_copy<iter_reference_t<I>, true, true>(
+							first, last, out_true, out_false, pred, proj);
+						return {std::move(last), std::move(out_true),
+							std::move(out_false)};
+					}
 				}
+				for (; first != last; ++first) {
+					iter_reference_t<I>&& v = *first;
+					if (__stl2::invoke(pred, __stl2::invoke(proj, v))) {
+						*out_true  = std::forward<iter_reference_t<I>>(v);
+						++out_true;
+					} else {
+						*out_false = std::forward<iter_reference_t<I>>(v);
+						++out_false;
+					}
+				}
+				return {std::move(first), std::move(out_true), std::move(out_false)};
 			}
-			return {std::move(first), std::move(out_true), std::move(out_false)};
 		}
 
 		template<InputRange R, WeaklyIncrementable O1, WeaklyIncrementable O2,
@@ -0,0 +1,110 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_RADIX_SORT_HPP
+#define STL2_DETAIL_ALGORITHM_RADIX_SORT_HPP
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// LSD radix sort
+// Sorting primitives for arithmetic keys, used by algorithms that can
+// tell their comparison is the built-in order.
+//
+// radix_key(t) maps an integer or floating-point value t to an unsigned
+// integer of the same width whose order is that of t under less: the sign
+// bit of signed integers is flipped, negative floating-point values are
+// complemented, and -0.0 maps to +0.0 so that zeroes that compare equal
+// stay equal.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class T>
+		META_CONCEPT __radix_key = std::is_arithmetic_v<T> && !Same<T, bool> &&
+			(std::is_integral_v<T> || sizeof(T) == 4 || sizeof(T) == 8);
+
+		template<__radix_key T>
+		constexpr auto radix_key(T t) noexcept {
+			if constexpr (std::is_floating_point_v<T>) {
+				using U = meta::if_c<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+				constexpr U sign = U{1} << (sizeof(U) * CHAR_BIT - 1);
+				U u = 0;
+				std::memcpy(&u, &t, sizeof(T));
+				// -0.0 as +0.0, in the representation so that -ffast-math
+				// cannot fold it away
+				if (static_cast<U>(u & ~sign) == 0) u = 0;
+				return static_cast<U>(u & sign ? ~u : u | sign);
+			} else {
+				using U = std::make_unsigned_t<T>;
+				if constexpr (std::is_signed_v<T>) {
+					constexpr U sign = U(U{1} << (sizeof(U) * CHAR_BIT - 1));
+					return static_cast<U>(static_cast<U>(t) ^ sign);
+				} else {
+					return static_cast<U>(t);
+				}
+			}
+		}
+
+		// Stably sort the n objects at first by key(e), an unsigned integer,
+		// one byte at a time, least significant first. tmp is uninitialized
+		// storage for n objects; the result is left at first. Passes over
+		// bytes that are the same in every key are skipped.
+		template<class T, class Key>
+		requires std::is_trivially_copyable_v<T> &&
+			std::is_unsigned_v<std::invoke_result_t<Key&, const T&>>
+		void radix_sort(T* first, std::ptrdiff_t n, T* tmp, Key key) {
+			using U = std::invoke_result_t<Key&, const T&>;
+			constexpr std::size_t passes = sizeof(U);
+			if (n < 2) return;
+
+			std::ptrdiff_t counts[passes][256] = {};
+			for (std::ptrdiff_t i = 0; i < n; ++i) {
+				const U k = key(first[i]);
+				for (std::size_t p = 0; p < passes; ++p) {
+					++counts[p][(k >> (p * CHAR_BIT)) & 0xff];
+				}
+			}
+
+			T* src = first;
+			T* dst = tmp;
+			const U k0 = key(first[0]);
+			for (std::size_t p = 0; p < passes; ++p) {
+				const unsigned shift = static_cast<unsigned>(p * CHAR_BIT);
+				auto& count = counts[p];
+				if (count[(k0 >> shift) & 0xff] == n) continue;
+
+				std::ptrdiff_t offset[256];
+				std::ptrdiff_t sum = 0;
+				for (int b = 0; b < 256; ++b) {
+					offset[b] = sum;
+					sum += count[b];
+				}
+				for (std::ptrdiff_t i = 0; i < n; ++i) {
+					const auto b = (key(src[i]) >> shift) & 0xff;
+					::new (static_cast<void*>(dst + offset[b]++)) T(src[i]);
+				}
+				std::swap(src, dst);
+			}
+			if (src != first) {
+				std::memcpy(static_cast<void*>(first), src, static_cast<std::size_t>(n) * sizeof(T));
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -12,12 +12,16 @@
 #ifndef STL2_DETAIL_ALGORITHM_REMOVE_IF_HPP
 #define STL2_DETAIL_ALGORITHM_REMOVE_IF_HPP
 
+#include <stl2/detail/algorithm/compress.hpp>
 #include <stl2/detail/algorithm/find_if.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // remove_if [alg.remove]
+// Contiguous ranges of small trivially copyable values are compacted
+// without branching on the predicate; see compress.hpp.
 //
 STL2_OPEN_NAMESPACE {
 	struct __remove_if_fn : private __niebloid {
@@ -25,17 +29,31 @@ STL2_OPEN_NAMESPACE {
 			IndirectUnaryPredicate<projected<I, Proj>> Pred>
 		constexpr I
 		operator()(I first, S last, Pred pred, Proj proj = {}) const {
-			first = find_if(std::move(first), last, __stl2::ref(pred),
-				__stl2::ref(proj));
-			if (first != last) {
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				return ext::rewrap(std::move(first), ufirst,
+					(*this)(ufirst, std::move(ulast), __stl2::ref(pred),
+						__stl2::ref(proj)));
+			} else {
+				first = find_if(std::move(first), last, __stl2::ref(pred),
+					__stl2::ref(proj));
+				if (first == last) return first;
+				if constexpr (detail::__compressible<I, S>) {
+					if (!detail::__is_constant_evaluated()) {
+						I none = nullptr;
+						detail::__compress<iter_reference_t<I>, false, true>(
+							first + 1, last, none, first, pred, proj);
+						return first;
+					}
+				}
 				for (auto m = next(first); m != last; ++m) {
 					if (!__stl2::invoke(pred, __stl2::invoke(proj, *m))) {
 						*first = iter_move(m);
 						++first;
 					}
 				}
+				return first;
 			}
-			return first;
 		}
 
 		template<ForwardRange Rng, class Proj = identity,
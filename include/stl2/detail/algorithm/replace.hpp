@@ -13,6 +13,7 @@
 #define STL2_DETAIL_ALGORITHM_REPLACE_HPP
 
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -27,12 +28,19 @@ STL2_OPEN_NAMESPACE {
 		constexpr I operator()(I first, S last, const T1& old_value,
 			const T2& new_value, Proj proj = {}) const
 		{
-			for (; first != last; ++first) {
-				if (__stl2::invoke(proj, *first) == old_value) {
-					*first = new_value;
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				return ext::rewrap(std::move(first), ufirst,
+					(*this)(ufirst, std::move(ulast), old_value, new_value,
+						__stl2::ref(proj)));
+			} else {
+				for (; first != last; ++first) {
+					if (__stl2::invoke(proj, *first) == old_value) {
+						*first = new_value;
+					}
 				}
+				return first;
 			}
-			return first;
 		}
 
 		template<InputRange R, class T1, class T2, class Proj = identity>
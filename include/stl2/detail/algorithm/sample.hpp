@@ -13,6 +13,9 @@
 #ifndef RANGES_V3_ALGORITHM_SAMPLE_HPP
 #define RANGES_V3_ALGORITHM_SAMPLE_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <stl2/random.hpp>
 #include <stl2/detail/randutils.hpp>
 #include <stl2/detail/algorithm/results.hpp>
@@ -21,6 +24,10 @@
 
 ////////////////////////////////////////////////////////////////////////////////
 // sample [Extension]
+// Draws O(n log(N / n)) random numbers to sample n of N elements, rather
+// than one per element: Vitter's Algorithm D skips between the elements
+// it selects when N is known, and Algorithm L skips between replacements
+// in the reservoir otherwise.
 //
 STL2_OPEN_NAMESPACE {
 	namespace ext {
@@ -49,23 +56,14 @@ STL2_OPEN_NAMESPACE {
 						k, std::move(o), n, gen);
 				} else {
 					if (n > 0) {
-						for (iter_difference_t<I> i = 0;
-						     i < n && bool(first != last);
-						     (void) ++i, (void) ++first)
-						{
+						iter_difference_t<I> i = 0;
+						for (; i < n && bool(first != last); (void) ++i, (void) ++first) {
 							o[i] = *first;
 						}
 						if (first != last) {
-							std::uniform_int_distribution<iter_difference_t<I>> dist;
-							using param_t = typename decltype(dist)::param_type;
-							for (auto pop_size = n; first != last;
-							     (void) ++first, ++pop_size)
-							{
-								const auto i = dist(gen, param_t{0, pop_size});
-								if (i < n) o[i] = *first;
-							}
-							o += n;
+							reservoir(first, last, o, n, gen);
 						}
+						o += i;
 					}
 					return {std::move(first), std::move(o)};
 				}
@@ -127,24 +125,130 @@ STL2_OPEN_NAMESPACE {
 				}
 			}
 		private:
+			// Vitter's Algorithm L: the reservoir o[0, n) holds a uniform
+			// sample of the elements seen so far. Rather than drawing for
+			// each element whether it replaces one in the reservoir, draw
+			// the number of elements to pass over before the next one does,
+			// from the running maximum w of n uniform keys.
+			template<class I, class S, class O, class Gen>
+			static void reservoir(I& first, const S& last, O o,
+				iter_difference_t<I> n, Gen& gen)
+			{
+				using D = iter_difference_t<I>;
+				const double ninv = 1.0 / static_cast<double>(n);
+				auto draw_w = [&] {
+					return std::exp(std::log(detail::__random_unit(gen)) * ninv);
+				};
+				for (double w = draw_w();; w *= draw_w()) {
+					const double skip = std::floor(
+						std::log(detail::__random_unit(gen)) / std::log1p(-w));
+					constexpr auto max = std::numeric_limits<D>::max();
+					const D k = skip < static_cast<double>(max) ? static_cast<D>(skip) : max;
+					if (__stl2::advance(first, k, last) != 0 || first == last) break;
+					o[detail::__bounded_random(gen, n)] = *first;
+					++first;
+				}
+			}
+
+			// Vitter's Algorithm D: select n of the pop_size elements at first,
+			// in order, drawing the number of elements to skip before each
+			// selection - O(n) random numbers rather than one per element.
+			// The skip is drawn by rejection from a continuous approximation
+			// of its distribution while pop_size is large relative to n, and
+			// by Algorithm A's sequential search otherwise.
 			template<class I, class S, class O, class Gen>
 			requires __sample_constraint<I, S, O, Gen>
 			static constexpr sample_result<I, O>
-			sized_impl(I first, S last, iter_difference_t<I> pop_size,
+			sized_impl(I first, S, iter_difference_t<I> pop_size,
 				O o, iter_difference_t<I> n, Gen& gen)
 			{
-				std::uniform_int_distribution<iter_difference_t<I>> dist;
-				using param_t = typename decltype(dist)::param_type;
+				using D = iter_difference_t<I>;
 				if (n > pop_size) {
 					n = pop_size;
 				}
-				for (; n > 0 && first != last; ++first) {
-					if (dist(gen, param_t{0, --pop_size}) < n) {
-						--n;
-						*o = *first;
-						++o;
+				if (n <= 0) return {std::move(first), std::move(o)};
+
+				auto select = [&](D skip) {
+					__stl2::advance(first, skip);
+					*o = *first;
+					++o;
+					++first;
+				};
+				auto unit = [&gen] { return detail::__random_unit(gen); };
+
+				D N = pop_size;
+				// Switch to Algorithm A when N <= alpha * n.
+				constexpr D alpha = 13;
+				D threshold = alpha * n;
+				double ninv = 1.0 / static_cast<double>(n);
+				double v = std::exp(std::log(unit()) * ninv);
+				D qu1 = N - n + 1;
+				while (n > 1 && threshold < N) {
+					const double nmin1inv = 1.0 / static_cast<double>(n - 1);
+					const double Nreal = static_cast<double>(N);
+					D skip;
+					for (;;) {
+						double x;
+						for (;;) {
+							x = Nreal * (1.0 - v);
+							skip = static_cast<D>(x);
+							if (skip < qu1) break;
+							v = std::exp(std::log(unit()) * ninv);
+						}
+						const double y1 = std::exp(std::log(
+							unit() * Nreal / static_cast<double>(qu1)) * nmin1inv);
+						v = y1 * (1.0 - x / Nreal) *
+							(static_cast<double>(qu1) / static_cast<double>(qu1 - skip));
+						if (v <= 1.0) break;
+
+						double y2 = 1.0;
+						double top = Nreal - 1.0;
+						double bottom;
+						D limit;
+						if (n - 1 > skip) {
+							bottom = static_cast<double>(N - n);
+							limit = N - skip;
+						} else {
+							bottom = static_cast<double>(N - skip - 1);
+							limit = qu1;
+						}
+						for (D t = N - 1; t >= limit; --t) {
+							y2 = y2 * top / bottom;
+							top -= 1.0;
+							bottom -= 1.0;
+						}
+						if (Nreal / (Nreal - x) >= y1 * std::exp(std::log(y2) * nmin1inv)) {
+							v = std::exp(std::log(unit()) * nmin1inv);
+							break;
+						}
+						v = std::exp(std::log(unit()) * ninv);
+					}
+					select(skip);
+					N -= skip + 1;
+					--n;
+					ninv = nmin1inv;
+					qu1 -= skip;
+					threshold -= alpha;
+				}
+				if (n > 1) {
+					// Algorithm A
+					double top = static_cast<double>(N - n);
+					double Nreal = static_cast<double>(N);
+					for (; n > 1; --n) {
+						const double u = unit();
+						D skip = 0;
+						for (double quot = top / Nreal; quot > u; quot *= top / Nreal) {
+							++skip;
+							top -= 1.0;
+							Nreal -= 1.0;
+						}
+						select(skip);
+						N -= skip + 1;
+						Nreal -= 1.0;
 					}
+					v = unit();
 				}
+				select(std::min(static_cast<D>(static_cast<double>(N) * v), N - 1));
 				return {std::move(first), std::move(o)};
 			}
 		};
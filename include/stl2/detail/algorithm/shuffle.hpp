@@ -19,6 +19,10 @@
 
 ///////////////////////////////////////////////////////////////////////////
 // shuffle [alg.random.shuffle]
+// Extension: swap partners are drawn with detail::__bounded_random rather
+// than uniform_int_distribution, two to a draw from generators of 64-bit
+// words. Pass an ext::xoshiro256pp for a generator cheaper than the
+// default mt19937_64.
 //
 STL2_OPEN_NAMESPACE {
 	struct __shuffle_fn : private __niebloid {
@@ -32,11 +36,25 @@ STL2_OPEN_NAMESPACE {
 			auto mid = first;
 			if (mid == last) return mid;
 			using D = iter_difference_t<I>;
-			auto dist = std::uniform_int_distribution<D>{};
-			using param_t =
-				typename std::uniform_int_distribution<D>::param_type;
-			while (++mid != last) {
-				if (auto const i = dist(g, param_t{0, mid - first})) {
+			D n = 1;
+			++mid;
+			if constexpr (detail::__word_bits<std::remove_reference_t<Gen>> == 64) {
+				// While the product of their bounds fits in a word, draw the
+				// partners of two elements at once: x in [0, (n + 1)(n + 2))
+				// is the pair (x / (n + 2), x % (n + 2)).
+				constexpr D pairs_below = D{1} << (sizeof(D) < 8 ? sizeof(D) * 8 - 2 : 31);
+				for (; mid != last && n < pairs_below; n += 2) {
+					auto next = __stl2::next(mid);
+					if (next == last) break;
+					const auto b = static_cast<std::uint64_t>(n + 2);
+					const auto x = detail::__bounded_random(g, (b - 1) * b);
+					iter_swap(first + static_cast<D>(x / b), mid);
+					iter_swap(first + static_cast<D>(x % b), next);
+					mid = ++next;
+				}
+			}
+			for (; mid != last; ++mid, ++n) {
+				if (auto const i = detail::__bounded_random(g, n + 1)) {
 					iter_swap(mid - i, mid);
 				}
 			}
@@ -13,9 +13,12 @@
 #ifndef STL2_DETAIL_ALGORITHM_SORT_HPP
 #define STL2_DETAIL_ALGORITHM_SORT_HPP
 
+#include <stl2/detail/algorithm/counting_sort_n.hpp>
 #include <stl2/detail/algorithm/forward_sort.hpp>
 #include <stl2/detail/algorithm/random_access_sort.hpp>
+#include <stl2/detail/algorithm/sorting_network.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
@@ -30,12 +33,21 @@ STL2_OPEN_NAMESPACE {
 		requires Sortable<I, Comp, Proj>
 		constexpr I
 		operator()(I first, S sent, Comp comp = {}, Proj proj = {}) const {
-			if constexpr (RandomAccessIterator<I>) {
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(sent));
+				return ext::rewrap(std::move(first), ufirst,
+					(*this)(ufirst, std::move(ulast), __stl2::ref(comp),
+						__stl2::ref(proj)));
+			} else if constexpr (RandomAccessIterator<I>) {
 				if (first == sent) return first;
 				auto last = next(first, std::move(sent));
 				auto n = distance(first, last);
+				if (!detail::__is_constant_evaluated() &&
+					detail::__try_counting_sort(first, n, comp, proj)) return last;
 				introsort_loop(first, last, log2(n) * 2, comp, proj);
-				final_insertion_sort(first, last, comp, proj);
+				if constexpr (!detail::__branchless_network<I>) {
+					final_insertion_sort(first, last, comp, proj);
+				}
 				return last;
 			} else {
 				auto n = distance(first, std::move(sent));
@@ -108,6 +120,12 @@ STL2_OPEN_NAMESPACE {
 				introsort_loop(cut, last, --depth_limit, comp, proj);
 				last = cut;
 			}
+			// Small values are sorted by network a partition at a time;
+			// anything else, by one insertion sort over the whole range.
+			if constexpr (detail::__branchless_network<I>) {
+				detail::network_sort_n<introsort_threshold>(first,
+					distance(first, last), comp, proj);
+			}
 		}
 
 		template<BidirectionalIterator I, class Comp, class Proj>
@@ -0,0 +1,191 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_SORT_BY_CACHED_KEY_HPP
+#define STL2_DETAIL_ALGORITHM_SORT_BY_CACHED_KEY_HPP
+
+#include <type_traits>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/temporary_vector.hpp>
+#include <stl2/detail/algorithm/radix_sort.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/primitives.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// sort_by_cached_key, stable_sort_by_cached_key [Extension]
+// Sort by the projections of the elements, evaluating the projection
+// exactly once per element: the keys are computed into a side array of
+// (key, index) pairs, which is sorted - by radix when the keys are
+// arithmetic and the comparison is less or greater - and the resulting
+// permutation is then applied to the range in place by following its
+// cycles, moving each element once. Worthwhile when the projection costs
+// more than moving an element; otherwise sort with the projection.
+//
+// The side array takes n (key, index) pairs from a temporary buffer, and
+// the radix sort n more. Without room for the side array, the range is
+// sorted - or stable_sorted - with the projection instead, evaluating it
+// on every comparison; without room for the radix sort's, the side array
+// is sorted by comparison.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class I, class Proj>
+		using __cached_key_t = __uncvref<invoke_result_t<Proj&, iter_reference_t<I>>>;
+
+		template<class I, class Comp, class Proj>
+		META_CONCEPT __sortable_by_cached_key = RandomAccessIterator<I> &&
+			Sortable<I, Comp, Proj> && Movable<__cached_key_t<I, Proj>> &&
+			Constructible<__cached_key_t<I, Proj>,
+				invoke_result_t<Proj&, iter_reference_t<I>>> &&
+			StrictWeakOrder<Comp&, const __cached_key_t<I, Proj>&,
+				const __cached_key_t<I, Proj>&>;
+
+		template<class K, class D>
+		struct cached_key_entry {
+			K key;
+			D index;
+		};
+
+		template<bool Stable>
+		struct sort_by_cached_key_impl {
+			static constexpr std::ptrdiff_t radix_threshold = 512;
+
+			template<class I, class Comp, class Proj>
+			static void sort(I first, iter_difference_t<I> n, Comp& comp, Proj& proj) {
+				using D = iter_difference_t<I>;
+				using K = __cached_key_t<I, Proj>;
+				using E = cached_key_entry<K, D>;
+				if (n < 2) return;
+
+				temporary_buffer<E> buf{n};
+				if (buf.size() < n) {
+					if constexpr (Stable) {
+						__stl2::stable_sort(first, first + n, __stl2::ref(comp),
+							__stl2::ref(proj));
+					} else {
+						__stl2::sort(first, first + n, __stl2::ref(comp),
+							__stl2::ref(proj));
+					}
+					return;
+				}
+				temporary_vector<E> keys{buf};
+				for (D i = 0; i < n; ++i) {
+					keys.emplace_back(E{K(__stl2::invoke(proj, first[i])), i});
+				}
+
+				if (!radix(keys, comp)) {
+					__stl2::sort(keys, [&comp](const E& a, const E& b) {
+						if (__stl2::invoke(comp, a.key, b.key)) return true;
+						if constexpr (Stable) {
+							return !__stl2::invoke(comp, b.key, a.key) && a.index < b.index;
+						} else {
+							return false;
+						}
+					});
+				}
+
+				// keys[i].index is the position of the element that belongs at
+				// i; mark each position as placed by pointing it at itself.
+				for (D i = 0; i < n; ++i) {
+					D j = keys[i].index;
+					if (j == i) continue;
+					iter_value_t<I> tmp = __stl2::iter_move(first + i);
+					D k = i;
+					do {
+						*(first + k) = __stl2::iter_move(first + j);
+						keys[k].index = k;
+						k = j;
+						j = keys[k].index;
+					} while (j != i);
+					*(first + k) = std::move(tmp);
+					keys[k].index = k;
+				}
+			}
+
+		private:
+			// Radix sort keys if comp is the built-in order, or its reverse,
+			// on arithmetic keys. Returns false if keys is left unsorted.
+			template<class E, class Comp>
+			static bool radix(temporary_vector<E>& keys, Comp&) {
+				using K = decltype(E::key);
+				constexpr bool ascending = __same_function_object<Comp, less>;
+				constexpr bool descending = __same_function_object<Comp, greater>;
+				if constexpr (__radix_key<K> && (ascending || descending) &&
+					std::is_trivially_copyable_v<E>)
+				{
+					const auto n = keys.size();
+					if (n < radix_threshold) return false;
+					temporary_buffer<E> tmp{n};
+					if (tmp.size() < n) return false;
+					detail::radix_sort(keys.begin(), n, tmp.data(), [](const E& e) {
+						if constexpr (ascending) {
+							return radix_key(e.key);
+						} else {
+							return static_cast<decltype(radix_key(e.key))>(~radix_key(e.key));
+						}
+					});
+					return true;
+				} else {
+					return false;
+				}
+			}
+		};
+	}
+
+	namespace ext {
+		struct __sort_by_cached_key_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires detail::__sortable_by_cached_key<I, Comp, Proj>
+			I operator()(I first, S sent, Comp comp = {}, Proj proj = {}) const {
+				auto last = __stl2::next(first, std::move(sent));
+				detail::sort_by_cached_key_impl<false>::sort(first,
+					iter_difference_t<I>(last - first), comp, proj);
+				return last;
+			}
+
+			template<RandomAccessRange R, class Comp = less, class Proj = identity>
+			requires detail::__sortable_by_cached_key<iterator_t<R>, Comp, Proj>
+			safe_iterator_t<R> operator()(R&& r, Comp comp = {}, Proj proj = {}) const {
+				return (*this)(__stl2::begin(r), __stl2::end(r), __stl2::ref(comp),
+					__stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __sort_by_cached_key_fn sort_by_cached_key {};
+
+		struct __stable_sort_by_cached_key_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires detail::__sortable_by_cached_key<I, Comp, Proj>
+			I operator()(I first, S sent, Comp comp = {}, Proj proj = {}) const {
+				auto last = __stl2::next(first, std::move(sent));
+				detail::sort_by_cached_key_impl<true>::sort(first,
+					iter_difference_t<I>(last - first), comp, proj);
+				return last;
+			}
+
+			template<RandomAccessRange R, class Comp = less, class Proj = identity>
+			requires detail::__sortable_by_cached_key<iterator_t<R>, Comp, Proj>
+			safe_iterator_t<R> operator()(R&& r, Comp comp = {}, Proj proj = {}) const {
+				return (*this)(__stl2::begin(r), __stl2::end(r), __stl2::ref(comp),
+					__stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __stable_sort_by_cached_key_fn stable_sort_by_cached_key {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
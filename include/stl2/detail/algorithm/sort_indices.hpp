@@ -0,0 +1,68 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_SORT_INDICES_HPP
+#define STL2_DETAIL_ALGORITHM_SORT_INDICES_HPP
+
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/primitives.hpp>
+#include <stl2/view/iota.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// sort_indices [Extension]
+// "argsort": the permutation that sorts [first, last), as a vector p of
+// indices such that the element that belongs at position i in sorted
+// order is first[p[i]]. The range itself is not modified. Equivalent
+// elements keep their relative order, so every column of a table sorted
+// by p is sorted stably. Apply p with apply_permutation.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __sort_indices_fn : private __niebloid {
+			template<RandomAccessIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<I, Proj>>
+			std::vector<iter_difference_t<I>>
+			operator()(I first, S last, Comp comp = {}, Proj proj = {}) const {
+				using D = iter_difference_t<I>;
+				const auto n = __stl2::distance(first, std::move(last));
+				std::vector<D> perm;
+				perm.reserve(static_cast<std::size_t>(n));
+				for (D i : iota_view<D, D>{D{0}, n}) {
+					perm.push_back(i);
+				}
+				__stl2::sort(perm, [&](D i, D j) {
+					auto&& a = __stl2::invoke(proj, first[i]);
+					auto&& b = __stl2::invoke(proj, first[j]);
+					if (__stl2::invoke(comp, a, b)) return true;
+					return i < j && !__stl2::invoke(comp, b, a);
+				});
+				return perm;
+			}
+
+			template<RandomAccessRange R, class Comp = less, class Proj = identity>
+			requires IndirectStrictWeakOrder<Comp, projected<iterator_t<R>, Proj>>
+			std::vector<iter_difference_t<iterator_t<R>>>
+			operator()(R&& r, Comp comp = {}, Proj proj = {}) const {
+				return (*this)(__stl2::begin(r), __stl2::end(r), __stl2::ref(comp),
+					__stl2::ref(proj));
+			}
+		};
+
+		inline constexpr __sort_indices_fn sort_indices {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,146 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_SORTING_NETWORK_HPP
+#define STL2_DETAIL_ALGORITHM_SORTING_NETWORK_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Sorting networks
+// Fixed sequences of compare-exchanges that sort any input of N elements,
+// for N up to 32: Batcher's odd-even merge sort, generated at compile time
+// and applied fully unrolled. Where the elements are small trivially
+// copyable values, each compare-exchange writes both of its elements
+// unconditionally - a min and a max - so that the network sorts without a
+// data-dependent branch; sort and nth_element then use networks for their
+// small partitions instead of insertion and selection sorts.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		inline constexpr std::size_t __max_network = 32;
+
+		// Call f(i, j) for each comparator of Batcher's network for n
+		// elements, in order.
+		template<class F>
+		constexpr void __batcher(std::size_t n, F f) {
+			for (std::size_t p = 1; p < n; p *= 2) {
+				for (std::size_t k = p; k >= 1; k /= 2) {
+					for (std::size_t j = k % p; j + k < n; j += 2 * k) {
+						for (std::size_t i = 0; i < k && i < n - j - k; ++i) {
+							if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+								f(i + j, i + j + k);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		struct __comparator {
+			unsigned char lo;
+			unsigned char hi;
+		};
+
+		template<std::size_t N>
+		constexpr std::size_t __network_size() {
+			std::size_t n = 0;
+			__batcher(N, [&n](std::size_t, std::size_t) { ++n; });
+			return n;
+		}
+
+		template<std::size_t N>
+		constexpr auto __make_network() {
+			std::array<__comparator, __network_size<N>()> net{};
+			std::size_t n = 0;
+			__batcher(N, [&](std::size_t i, std::size_t j) {
+				net[n++] = __comparator{static_cast<unsigned char>(i),
+					static_cast<unsigned char>(j)};
+			});
+			return net;
+		}
+
+		template<std::size_t N>
+		requires N <= __max_network
+		inline constexpr auto __network = __make_network<N>();
+
+		// Compare-exchanges of values, rather than through references,
+		// compile to conditional moves.
+		template<class I>
+		META_CONCEPT __branchless_network =
+			Same<iter_reference_t<I>, iter_value_t<I>&> &&
+			std::is_trivially_copyable_v<iter_value_t<I>> &&
+			sizeof(iter_value_t<I>) <= 2 * sizeof(void*);
+
+		template<class I, class Comp, class Proj>
+		constexpr void __compare_exchange(I a, I b, Comp& comp, Proj& proj) {
+			if constexpr (__branchless_network<I>) {
+				iter_value_t<I> x = *a;
+				iter_value_t<I> y = *b;
+				const bool swap = __stl2::invoke(comp,
+					__stl2::invoke(proj, y), __stl2::invoke(proj, x));
+				*a = swap ? y : x;
+				*b = swap ? x : y;
+			} else {
+				if (__stl2::invoke(comp, __stl2::invoke(proj, *b),
+						__stl2::invoke(proj, *a))) {
+					__stl2::iter_swap(a, b);
+				}
+			}
+		}
+
+		template<std::size_t N, class I, class Comp, class Proj, std::size_t... Is>
+		constexpr void __network_sort([[maybe_unused]] I first,
+			[[maybe_unused]] Comp& comp, [[maybe_unused]] Proj& proj,
+			std::index_sequence<Is...>)
+		{
+			using D = iter_difference_t<I>;
+			(__compare_exchange(first + static_cast<D>(__network<N>[Is].lo),
+				first + static_cast<D>(__network<N>[Is].hi), comp, proj), ...);
+		}
+
+		// Sort the N elements at first with the network for N.
+		template<std::size_t N, RandomAccessIterator I, class Comp, class Proj>
+		requires N <= __max_network && Sortable<I, Comp, Proj>
+		constexpr void network_sort(I first, Comp& comp, Proj& proj) {
+			__network_sort<N>(std::move(first), comp, proj,
+				std::make_index_sequence<__network<N>.size()>{});
+		}
+
+		template<RandomAccessIterator I, class Comp, class Proj, std::size_t... Ns>
+		constexpr void __network_sort_n(I first, iter_difference_t<I> n, Comp& comp,
+			Proj& proj, std::index_sequence<Ns...>)
+		{
+			(void)((n == static_cast<iter_difference_t<I>>(Ns) &&
+				(network_sort<Ns>(first, comp, proj), true)) || ...);
+		}
+
+		// Sort the n <= Max elements at first with the network for n.
+		template<std::size_t Max, RandomAccessIterator I, class Comp, class Proj>
+		requires Max <= __max_network && Sortable<I, Comp, Proj>
+		constexpr void network_sort_n(I first, iter_difference_t<I> n, Comp& comp,
+			Proj& proj)
+		{
+			STL2_EXPECT(0 <= n && n <= static_cast<iter_difference_t<I>>(Max));
+			__network_sort_n(std::move(first), n, comp, proj,
+				std::make_index_sequence<Max + 1>{});
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
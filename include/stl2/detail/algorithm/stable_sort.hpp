@@ -35,6 +35,7 @@
 #ifndef STL2_DETAIL_ALGORITHM_STABLE_SORT_HPP
 #define STL2_DETAIL_ALGORITHM_STABLE_SORT_HPP
 
+#include <stl2/detail/algorithm/counting_sort_n.hpp>
 #include <stl2/detail/algorithm/forward_sort.hpp>
 #include <stl2/detail/algorithm/inplace_merge.hpp>
 #include <stl2/detail/algorithm/merge.hpp>
@@ -57,8 +58,9 @@ STL2_OPEN_NAMESPACE {
 			if constexpr (RandomAccessIterator<I>) {
 				auto last = next(first, std::forward<S>(last_));
 				auto len = iter_difference_t<I>(last - first);
+				if (detail::__try_counting_sort(first, len, comp, proj)) return last;
 				auto buf = len > 256 ? buf_t<I>{len} : buf_t<I>{};
-				if (!buf.size_) {
+				if (!buf.size()) {
 					inplace_stable_sort(first, last, comp, proj);
 				} else {
 					stable_sort_adaptive(first, last, buf, comp, proj);
@@ -0,0 +1,178 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_TOP_K_HPP
+#define STL2_DETAIL_ALGORITHM_TOP_K_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/parallel_for.hpp>
+#include <stl2/detail/algorithm/merge_k.hpp>
+#include <stl2/detail/algorithm/nth_element.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/primitives.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// top_k [Extension]
+// The k least elements of a single pass over [first, last), in sorted
+// order: partial_sort_copy for input ranges, into a vector. Elements are
+// collected into a buffer of 2k; when it fills, nth_element keeps the
+// least k and the greatest of those becomes a threshold that later
+// elements must beat to be collected at all. Each element costs one
+// comparison against the threshold, and each refill of k elements costs
+// O(k), so the whole is O(n + k log k) rather than the O(n log k) of a
+// heap. Which of several equivalent elements are kept is unspecified.
+//
+// The top k of a union is the top k of the union of the parts' top k:
+// results for parts of the input computed separately combine with
+// merge_k, keeping the first k elements. Given a number of threads (0
+// meaning one per hardware thread), top_k of a sized random-access range
+// does just that: each thread takes the top k of a part of the range, of
+// at least 16K elements and 2k, and the parts' results are merged. comp
+// and proj are then called concurrently.
+//
+// Since it may start threads, top_k is not included by
+// <stl2/algorithm.hpp>; include this header, and link with the threads
+// library, to use it.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __top_k_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, class Comp = less,
+				class Proj = identity>
+			requires IndirectlyCopyable<I, iter_value_t<I>*> &&
+				Sortable<iter_value_t<I>*, Comp, Proj>
+			std::vector<iter_value_t<I>>
+			operator()(I first, S last, iter_difference_t<I> k, Comp comp = {},
+				Proj proj = {}) const
+			{
+				std::vector<iter_value_t<I>> buf;
+				if (k <= 0) return buf;
+				const auto n = static_cast<std::size_t>(k);
+				const std::size_t cap = n < buf.max_size() / 2 ? 2 * n : buf.max_size();
+				if constexpr (SizedSentinel<S, I>) {
+					buf.reserve(std::min(cap,
+						static_cast<std::size_t>(std::max(last - first, iter_difference_t<I>{0}))));
+				}
+
+				auto keep_least = [&] {
+					__stl2::nth_element(buf.begin(), buf.begin() + (n - 1), buf.end(),
+						__stl2::ref(comp), __stl2::ref(proj));
+					buf.resize(n);
+				};
+
+				// Until the buffer first fills, every element is collected.
+				for (; first != last && buf.size() < cap; ++first) {
+					buf.push_back(*first);
+				}
+				while (first != last) {
+					keep_least();
+					// The greatest element kept is the threshold; it stays put,
+					// and the buffer has the capacity to refill without moving
+					// it, until the next keep_least.
+					auto&& bound = __stl2::invoke(proj, buf[n - 1]);
+					for (; first != last; ++first) {
+						if (__stl2::invoke(comp, __stl2::invoke(proj, *first), bound)) {
+							buf.push_back(*first);
+							if (buf.size() == cap) {
+								++first;
+								break;
+							}
+						}
+					}
+				}
+				if (buf.size() > n) keep_least();
+				__stl2::sort(buf, __stl2::ref(comp), __stl2::ref(proj));
+				return buf;
+			}
+
+			template<RandomAccessIterator I, SizedSentinel<I> S, class Comp,
+				class Proj>
+			requires IndirectlyCopyable<I, iter_value_t<I>*> &&
+				Sortable<iter_value_t<I>*, Comp, Proj>
+			std::vector<iter_value_t<I>>
+			operator()(I first, S last, iter_difference_t<I> k, Comp comp,
+				Proj proj, unsigned threads) const
+			{
+				using D = iter_difference_t<I>;
+				const D n = last - first;
+				if (threads == 0) {
+					threads = std::max(std::thread::hardware_concurrency(), 1u);
+				}
+				const D chunk = std::max<D>(k < n / 2 ? 2 * k : n, min_chunk);
+				const auto workers = static_cast<unsigned>(
+					std::min<D>(threads, std::max<D>(n / chunk, 1)));
+				if (workers <= 1 || k <= 0) {
+					return (*this)(std::move(first), std::move(last), k,
+						__stl2::ref(comp), __stl2::ref(proj));
+				}
+
+				std::vector<std::vector<iter_value_t<I>>> parts(workers);
+				detail::__parallel_for(workers, [&](unsigned w) {
+					auto part = [&](unsigned i) {
+						return first + static_cast<D>(n / workers * i +
+							std::min<D>(i, n % workers));
+					};
+					parts[w] = (*this)(part(w), part(w + 1), k,
+						__stl2::ref(comp), __stl2::ref(proj));
+				});
+				std::vector<iter_value_t<I>> result;
+				result.reserve(static_cast<std::size_t>(k) * workers);
+				merge_k(parts, __stl2::back_inserter(result),
+					__stl2::ref(comp), __stl2::ref(proj));
+				if (static_cast<std::size_t>(k) < result.size()) {
+					result.erase(result.begin() + k, result.end());
+				}
+				return result;
+			}
+
+			template<InputRange R, class Comp = less, class Proj = identity>
+			requires IndirectlyCopyable<iterator_t<R>, iter_value_t<iterator_t<R>>*> &&
+				Sortable<iter_value_t<iterator_t<R>>*, Comp, Proj>
+			std::vector<iter_value_t<iterator_t<R>>>
+			operator()(R&& r, iter_difference_t<iterator_t<R>> k, Comp comp = {},
+				Proj proj = {}) const
+			{
+				return (*this)(__stl2::begin(r), __stl2::end(r), k,
+					__stl2::ref(comp), __stl2::ref(proj));
+			}
+
+			template<RandomAccessRange R, class Comp, class Proj>
+			requires SizedRange<R> &&
+				IndirectlyCopyable<iterator_t<R>, iter_value_t<iterator_t<R>>*> &&
+				Sortable<iter_value_t<iterator_t<R>>*, Comp, Proj>
+			std::vector<iter_value_t<iterator_t<R>>>
+			operator()(R&& r, iter_difference_t<iterator_t<R>> k, Comp comp,
+				Proj proj, unsigned threads) const
+			{
+				return (*this)(__stl2::begin(r), __stl2::begin(r) + __stl2::distance(r),
+					k, __stl2::ref(comp), __stl2::ref(proj), threads);
+			}
+
+		private:
+			// The least part of the input worth a thread of its own.
+			static constexpr std::ptrdiff_t min_chunk = 1 << 14;
+		};
+
+		inline constexpr __top_k_fn top_k {};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
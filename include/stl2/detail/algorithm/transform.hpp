@@ -15,6 +15,7 @@
 
 #include <stl2/detail/algorithm/results.hpp>
 #include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/unwrap.hpp>
 #include <stl2/detail/range/primitives.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -33,10 +34,18 @@ STL2_OPEN_NAMESPACE {
 		requires Writable<O, indirect_result_t<F&, projected<I, Proj>>>
 		constexpr unary_transform_result<I, O>
 		operator()(I first, S last, O result, F op, Proj proj = {}) const {
-			for (; first != last; (void) ++first, (void) ++result) {
-				*result = __stl2::invoke(op, __stl2::invoke(proj, *first));
+			if constexpr (ext::Unwrappable<I, S>) {
+				auto [ufirst, ulast] = ext::unwrap(first, std::move(last));
+				auto [uend, out] = (*this)(ufirst, std::move(ulast), std::move(result),
+					__stl2::ref(op), __stl2::ref(proj));
+				return {ext::rewrap(std::move(first), ufirst, std::move(uend)),
+					std::move(out)};
+			} else {
+				for (; first != last; (void) ++first, (void) ++result) {
+					*result = __stl2::invoke(op, __stl2::invoke(proj, *first));
+				}
+				return {std::move(first), std::move(result)};
 			}
-			return {std::move(first), std::move(result)};
 		}
 
 		template<InputRange R, WeaklyIncrementable O, CopyConstructible F,
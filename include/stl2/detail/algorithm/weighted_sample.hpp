@@ -0,0 +1,141 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALGORITHM_WEIGHTED_SAMPLE_HPP
+#define STL2_DETAIL_ALGORITHM_WEIGHTED_SAMPLE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/random.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/randutils.hpp>
+#include <stl2/detail/algorithm/pop_heap.hpp>
+#include <stl2/detail/algorithm/push_heap.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// weighted_sample [Extension]
+// k of the elements of [first, last), drawn without replacement with
+// probabilities proportional to their weights, the projections of the
+// elements by weight: each element of weight w is keyed u^(1/w) for u
+// uniform in (0, 1], and the k greatest keys are sampled (Efraimidis and
+// Spirakis). The input is read once, keeping the k greatest keys in a
+// heap; rather than drawing a key for every element, Algorithm A-ExpJ
+// draws the total weight to pass over before the next element whose key
+// makes the heap, and that element's key conditioned on making it - O(k
+// log(n / k)) random numbers in all.
+//
+// The sample is returned in decreasing order of key, which is the order
+// of successive weighted draws without replacement. Elements of weight
+// zero are never sampled; fewer than k are returned if fewer have
+// positive weight.
+//
+// Precondition: the weights are nonnegative.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		struct __weighted_sample_fn : private __niebloid {
+			template<InputIterator I, Sentinel<I> S, class Weight,
+				class Gen = detail::default_random_engine&>
+			requires IndirectlyCopyable<I, iter_value_t<I>*> &&
+				IndirectUnaryInvocable<Weight, I> &&
+				std::is_arithmetic_v<__uncvref<indirect_result_t<Weight&, I>>> &&
+				UniformRandomBitGenerator<std::remove_reference_t<Gen>>
+			std::vector<iter_value_t<I>>
+			operator()(I first, S last, Weight weight, iter_difference_t<I> k,
+				Gen&& g = detail::get_random_engine()) const
+			{
+				std::vector<iter_value_t<I>> sample;
+				if (k <= 0) return sample;
+				const auto n = static_cast<std::size_t>(k);
+
+				// The log of each key, and where its element is in sample.
+				struct entry {
+					double key;
+					std::size_t slot;
+				};
+				std::vector<entry> heap;
+				auto weight_of = [&weight](auto&& x) {
+					const auto w = static_cast<double>(__stl2::invoke(weight,
+						static_cast<decltype(x)>(x)));
+					STL2_EXPECT(w >= 0);
+					return w;
+				};
+				auto log_unit = [&g] { return std::log(detail::__random_unit(g)); };
+
+				for (; first != last && sample.size() < n; ++first) {
+					const double w = weight_of(*first);
+					if (w > 0) {
+						heap.push_back(entry{log_unit() / w, sample.size()});
+						__stl2::push_heap(heap, greater{}, &entry::key);
+						sample.push_back(*first);
+					}
+				}
+				if (sample.size() == n) {
+					// The least key kept, and the weight to pass over before an
+					// element's key exceeds it.
+					double least = heap.front().key;
+					auto jump = [&] {
+						return least < 0 ? log_unit() / least
+							: std::numeric_limits<double>::infinity();
+					};
+					for (double skip = jump(); first != last; ++first) {
+						const double w = weight_of(*first);
+						if (w <= 0 || (skip -= w) > 0) continue;
+						// Its key is uniform in (least^w, 1] to the 1/w.
+						const double lo = std::exp(least * w);
+						const double u = lo + (1 - lo) * detail::__random_unit(g);
+						__stl2::pop_heap(heap, greater{}, &entry::key);
+						heap.back().key = std::log(u) / w;
+						sample[heap.back().slot] = *first;
+						__stl2::push_heap(heap, greater{}, &entry::key);
+						least = heap.front().key;
+						skip = jump();
+					}
+				}
+
+				__stl2::sort(heap, greater{}, &entry::key);
+				std::vector<iter_value_t<I>> ordered;
+				ordered.reserve(sample.size());
+				for (const auto& e : heap) {
+					ordered.push_back(std::move(sample[e.slot]));
+				}
+				return ordered;
+			}
+
+			template<InputRange R, class Weight,
+				class Gen = detail::default_random_engine&>
+			requires IndirectlyCopyable<iterator_t<R>, iter_value_t<iterator_t<R>>*> &&
+				IndirectUnaryInvocable<Weight, iterator_t<R>> &&
+				std::is_arithmetic_v<__uncvref<indirect_result_t<Weight&, iterator_t<R>>>> &&
+				UniformRandomBitGenerator<std::remove_reference_t<Gen>>
+			std::vector<iter_value_t<iterator_t<R>>>
+			operator()(R&& r, Weight weight, iter_difference_t<iterator_t<R>> k,
+				Gen&& g = detail::get_random_engine()) const
+			{
+				return (*this)(__stl2::begin(r), __stl2::end(r),
+					__stl2::ref(weight), k, g);
+			}
+		};
+
+		inline constexpr __weighted_sample_fn weighted_sample {};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,120 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ALIAS_TABLE_HPP
+#define STL2_DETAIL_ALIAS_TABLE_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/random.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/randutils.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// alias_table [Extension]
+// Draws indices 0 through n - 1 with probabilities proportional to n
+// nonnegative weights, in O(1) per draw after O(n) construction by Vose's
+// alias method. Each of the n slots is an index with probability p and an
+// alias for the rest: a draw picks a slot uniformly and then one of its
+// two indices, with a random number for each.
+//
+// Precondition: the weights are nonnegative and not all zero.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		class alias_table {
+		public:
+			using size_type = std::size_t;
+
+			alias_table() = default;
+
+			template<InputRange R, class Proj = identity>
+			requires std::is_arithmetic_v<
+				__uncvref<indirect_result_t<Proj&, iterator_t<R>>>>
+			explicit alias_table(R&& weights, Proj proj = {})
+			{
+				std::vector<double> p;
+				if constexpr (SizedRange<R>) {
+					p.reserve(static_cast<std::size_t>(__stl2::size(weights)));
+				}
+				double sum = 0;
+				for (auto&& w : weights) {
+					const auto x = static_cast<double>(__stl2::invoke(proj,
+						static_cast<decltype(w)>(w)));
+					STL2_EXPECT(x >= 0);
+					p.push_back(x);
+					sum += x;
+				}
+				STL2_EXPECT(sum > 0);
+				build(std::move(p), sum);
+			}
+
+			bool empty() const noexcept { return slots_.empty(); }
+			size_type size() const noexcept { return slots_.size(); }
+
+			template<class Gen = detail::default_random_engine&>
+			requires UniformRandomBitGenerator<std::remove_reference_t<Gen>>
+			size_type operator()(Gen&& g = detail::get_random_engine()) const
+			{
+				STL2_EXPECT(!empty());
+				const size_type i = detail::__bounded_random(g, slots_.size());
+				return detail::__random_unit(g) <= slots_[i].p ? i : slots_[i].alias;
+			}
+
+		private:
+			struct slot {
+				double p;
+				size_type alias;
+			};
+			std::vector<slot> slots_;
+
+			void build(std::vector<double> p, double sum)
+			{
+				const size_type n = p.size();
+				slots_.resize(n);
+				// Scale to mean 1, and sort the indices into those under and
+				// over: each slot of an index under 1 is filled out by an
+				// index over 1, which is left with less. Indices of weight
+				// zero go on top, to be paired while indices over 1 remain.
+				std::vector<size_type> under, over;
+				for (size_type i = 0; i < n; ++i) {
+					p[i] = p[i] * static_cast<double>(n) / sum;
+					if (p[i] > 0) (p[i] < 1 ? under : over).push_back(i);
+				}
+				for (size_type i = 0; i < n; ++i) {
+					if (p[i] == 0) under.push_back(i);
+				}
+				while (!under.empty() && !over.empty()) {
+					const size_type u = under.back();
+					under.pop_back();
+					const size_type o = over.back();
+					slots_[u] = slot{p[u], o};
+					p[o] -= 1 - p[u];
+					if (p[o] < 1) {
+						over.pop_back();
+						under.push_back(o);
+					}
+				}
+				// What remains is 1 but for rounding.
+				for (auto i : over) slots_[i] = slot{1, i};
+				for (auto i : under) slots_[i] = slot{1, i};
+			}
+		};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
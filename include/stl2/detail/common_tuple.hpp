@@ -0,0 +1,231 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_COMMON_TUPLE_HPP
+#define STL2_DETAIL_COMMON_TUPLE_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/swap.hpp>
+#include <stl2/detail/concepts/object.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// common_tuple [Extension]
+// A std::tuple that behaves as a reference when its elements are
+// references: it converts from any tuple of compatible elements, assigns
+// through its elements even when const, and has a common reference with
+// such tuples. It is the reference type of iterators that pack several
+// iterators together - zip_view - so that an element can be read into a
+// std::tuple of values and written back from one.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class... Ts>
+		struct common_tuple : std::tuple<Ts...> {
+		private:
+			using base_t = std::tuple<Ts...>;
+
+			template<class Tuple, std::size_t... Is>
+			constexpr common_tuple(Tuple&& t, std::index_sequence<Is...>)
+			: base_t(std::get<Is>(static_cast<Tuple&&>(t))...) {}
+
+			template<class Tuple, std::size_t... Is>
+			constexpr void assign(Tuple&& t, std::index_sequence<Is...>) const {
+				((void)(std::get<Is>(base()) = std::get<Is>(static_cast<Tuple&&>(t))), ...);
+			}
+
+			constexpr const base_t& base() const noexcept { return *this; }
+
+			using indices = std::index_sequence_for<Ts...>;
+		public:
+			using base_t::base_t;
+
+			common_tuple() = default;
+			common_tuple(const common_tuple&) = default;
+			common_tuple(common_tuple&&) = default;
+
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) &&
+				(Constructible<Ts, Us&> && ...)
+			constexpr common_tuple(std::tuple<Us...>& t)
+			: common_tuple(t, indices{}) {}
+
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) &&
+				(Constructible<Ts, const Us&> && ...)
+			constexpr common_tuple(const std::tuple<Us...>& t)
+			: common_tuple(t, indices{}) {}
+
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) &&
+				(Constructible<Ts, Us&&> && ...)
+			constexpr common_tuple(std::tuple<Us...>&& t)
+			: common_tuple(std::move(t), indices{}) {}
+
+			// Assignment copies the elements, or writes through them when they
+			// are references; the latter is what makes a const common_tuple of
+			// references assignable.
+			constexpr common_tuple& operator=(const common_tuple& that)
+			requires (Assignable<Ts&, const Ts&> && ...)
+			{
+				static_cast<base_t&>(*this) = that;
+				return *this;
+			}
+			constexpr common_tuple& operator=(common_tuple&& that)
+			requires (Assignable<Ts&, Ts> && ...)
+			{
+				static_cast<base_t&>(*this) = std::move(that);
+				return *this;
+			}
+
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) &&
+				(Assignable<Ts&, Us&> && ...)
+			constexpr common_tuple& operator=(std::tuple<Us...>& t) {
+				static_cast<base_t&>(*this) = t;
+				return *this;
+			}
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) &&
+				(Assignable<Ts&, const Us&> && ...)
+			constexpr common_tuple& operator=(const std::tuple<Us...>& t) {
+				static_cast<base_t&>(*this) = t;
+				return *this;
+			}
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) &&
+				(Assignable<Ts&, Us&&> && ...)
+			constexpr common_tuple& operator=(std::tuple<Us...>&& t) {
+				static_cast<base_t&>(*this) = std::move(t);
+				return *this;
+			}
+
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) &&
+				(std::is_reference_v<Ts> && ...) &&
+				(Assignable<Ts, Us&> && ...)
+			constexpr const common_tuple& operator=(std::tuple<Us...>& t) const {
+				assign(t, indices{});
+				return *this;
+			}
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) &&
+				(std::is_reference_v<Ts> && ...) &&
+				(Assignable<Ts, const Us&> && ...)
+			constexpr const common_tuple& operator=(const std::tuple<Us...>& t) const {
+				assign(t, indices{});
+				return *this;
+			}
+			template<class... Us>
+			requires sizeof...(Us) == sizeof...(Ts) &&
+				(std::is_reference_v<Ts> && ...) &&
+				(Assignable<Ts, Us&&> && ...)
+			constexpr const common_tuple& operator=(std::tuple<Us...>&& t) const {
+				assign(std::move(t), indices{});
+				return *this;
+			}
+		};
+
+		template<class... Ts>
+		common_tuple(Ts...) -> common_tuple<Ts...>;
+
+		// Swapping two common_tuples of references swaps the referents.
+		template<class... Ts, class... Us>
+		requires sizeof...(Ts) == sizeof...(Us) &&
+			(std::is_reference_v<Ts> && ...) && (std::is_reference_v<Us> && ...) &&
+			(SwappableWith<Ts, Us> && ...)
+		constexpr void swap(const common_tuple<Ts...>& x, const common_tuple<Us...>& y)
+		noexcept((is_nothrow_swappable_v<Ts, Us> && ...))
+		{
+			std::apply([&y](auto&&... xs) {
+				std::apply([&xs...](auto&&... ys) {
+					(__stl2::swap(static_cast<decltype(xs)>(xs),
+						static_cast<decltype(ys)>(ys)), ...);
+				}, static_cast<const std::tuple<Us...>&>(y));
+			}, static_cast<const std::tuple<Ts...>&>(x));
+		}
+	} // namespace ext
+
+	namespace detail {
+		template<class, class, template<class> class, template<class> class>
+		struct __common_tuple_reference {};
+		template<class... Ts, class... Us,
+			template<class> class TQual, template<class> class UQual>
+		requires sizeof...(Ts) == sizeof...(Us) &&
+			(CommonReference<TQual<Ts>, UQual<Us>> && ...)
+		struct __common_tuple_reference<
+			std::tuple<Ts...>, std::tuple<Us...>, TQual, UQual>
+		{
+			using type = ext::common_tuple<
+				common_reference_t<TQual<Ts>, UQual<Us>>...>;
+		};
+	}
+
+	// common_reference specializations for common_tuple
+	template<class... Ts, class... Us,
+		template<class> class TQual, template<class> class UQual>
+	struct basic_common_reference<
+		ext::common_tuple<Ts...>, ext::common_tuple<Us...>, TQual, UQual>
+	: detail::__common_tuple_reference<
+		std::tuple<Ts...>, std::tuple<Us...>, TQual, UQual>
+	{};
+	template<class... Ts, class... Us,
+		template<class> class TQual, template<class> class UQual>
+	struct basic_common_reference<
+		ext::common_tuple<Ts...>, std::tuple<Us...>, TQual, UQual>
+	: detail::__common_tuple_reference<
+		std::tuple<Ts...>, std::tuple<Us...>, TQual, UQual>
+	{};
+	template<class... Ts, class... Us,
+		template<class> class TQual, template<class> class UQual>
+	struct basic_common_reference<
+		std::tuple<Ts...>, ext::common_tuple<Us...>, TQual, UQual>
+	: detail::__common_tuple_reference<
+		std::tuple<Ts...>, std::tuple<Us...>, TQual, UQual>
+	{};
+
+	// common_type specializations for common_tuple
+	template<class... Ts, class... Us>
+	requires sizeof...(Ts) == sizeof...(Us) &&
+		(Common<Ts, Us> && ...)
+	struct common_type<ext::common_tuple<Ts...>, ext::common_tuple<Us...>> {
+		using type = std::tuple<common_type_t<Ts, Us>...>;
+	};
+	template<class... Ts, class... Us>
+	requires sizeof...(Ts) == sizeof...(Us) &&
+		(Common<Ts, Us> && ...)
+	struct common_type<ext::common_tuple<Ts...>, std::tuple<Us...>> {
+		using type = std::tuple<common_type_t<Ts, Us>...>;
+	};
+	template<class... Ts, class... Us>
+	requires sizeof...(Ts) == sizeof...(Us) &&
+		(Common<Ts, Us> && ...)
+	struct common_type<std::tuple<Ts...>, ext::common_tuple<Us...>> {
+		using type = std::tuple<common_type_t<Ts, Us>...>;
+	};
+} STL2_CLOSE_NAMESPACE
+
+namespace std {
+	template<class... Ts>
+	struct tuple_size<::__stl2::ext::common_tuple<Ts...>>
+	: integral_constant<size_t, sizeof...(Ts)> {};
+
+	template<size_t I, class... Ts>
+	struct tuple_element<I, ::__stl2::ext::common_tuple<Ts...>>
+	: tuple_element<I, tuple<Ts...>> {};
+}
+
+#endif
@@ -0,0 +1,694 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_FLAT_HASH_MAP_HPP
+#define STL2_DETAIL_FLAT_HASH_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <tuple>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/primitives.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// flat_hash_set and flat_hash_map [Extension]
+// Open-addressing hash containers that store their elements inline in a
+// single array, after the design of Abseil's SwissTable. Each slot has a
+// control byte that is either empty, deleted, or - for a full slot - the
+// low seven bits of the hash of its element's key. Lookup probes the
+// control bytes a group of 16 at a time, comparing all of them against
+// the key's seven bits at once, so that keys are compared only for
+// likely matches; the groups are visited in triangular order.
+//
+// The key of an element is its projection: flat_hash_set<T, Proj> holds
+// elements of type T with distinct keys invoke(proj, t). Lookup takes a
+// key of the projected key type; a key that ext::enable_hash_lookup
+// declares to hash alike - e.g., a std::string_view for std::string keys;
+// or one that converts to the key type, such as a string literal, which is
+// converted before it is hashed.
+// flat_hash_map<K, V> is a set of pair<const K, V> keyed on first.
+//
+// Both are sized forward ranges. Iterators and references are invalidated
+// by any insertion that grows the table.
+//
+STL2_OPEN_NAMESPACE {
+	namespace __flat_hash {
+		using ctrl_t = signed char;
+
+		inline constexpr ctrl_t ctrl_empty = -128;
+		inline constexpr ctrl_t ctrl_deleted = -2;
+		inline constexpr ctrl_t ctrl_sentinel = -1;
+
+		// The control bytes of an empty table with no allocation: lookups
+		// find no match and stop at the first group, and iteration stops
+		// immediately at the sentinel.
+		alignas(16) inline constexpr ctrl_t empty_group[16] = {
+			ctrl_sentinel, ctrl_empty, ctrl_empty, ctrl_empty,
+			ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+			ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+			ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty
+		};
+
+		// Sixteen control bytes, matched in parallel. Each match returns a
+		// mask with bit i set iff byte i matches.
+		struct group {
+			static constexpr std::size_t width = 16;
+
+#if defined(__SSE2__)
+			__m128i ctrl;
+
+			explicit group(const ctrl_t* p) noexcept
+			: ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+			unsigned match(ctrl_t h) const noexcept {
+				return static_cast<unsigned>(
+					_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h), ctrl)));
+			}
+			unsigned match_empty_or_deleted() const noexcept {
+				return static_cast<unsigned>(
+					_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(ctrl_sentinel), ctrl)));
+			}
+#else
+			ctrl_t ctrl[width];
+
+			explicit group(const ctrl_t* p) noexcept {
+				std::memcpy(ctrl, p, width);
+			}
+
+			unsigned match(ctrl_t h) const noexcept {
+				unsigned mask = 0;
+				for (std::size_t i = 0; i < width; ++i) {
+					mask |= unsigned{ctrl[i] == h} << i;
+				}
+				return mask;
+			}
+			unsigned match_empty_or_deleted() const noexcept {
+				unsigned mask = 0;
+				for (std::size_t i = 0; i < width; ++i) {
+					mask |= unsigned{ctrl[i] < ctrl_sentinel} << i;
+				}
+				return mask;
+			}
+#endif
+			unsigned match_empty() const noexcept {
+				return match(ctrl_empty);
+			}
+			// The number of empty or deleted bytes before the first full
+			// byte or the sentinel.
+			std::size_t count_leading_empty_or_deleted() const noexcept {
+				return static_cast<std::size_t>(
+					__builtin_ctz(~match_empty_or_deleted()));
+			}
+		};
+
+		inline std::size_t lowest(unsigned mask) noexcept {
+			STL2_EXPECT(mask != 0);
+			return static_cast<std::size_t>(__builtin_ctz(mask));
+		}
+		inline std::size_t leading_zeros(unsigned mask) noexcept {
+			// mask has group::width significant bits
+			return mask == 0 ? group::width :
+				static_cast<std::size_t>(__builtin_clz(mask)) -
+					(sizeof(unsigned) * 8 - group::width);
+		}
+
+		// Keys are located by the high bits of their hash and matched by
+		// the low seven bits.
+		inline std::size_t h1(std::size_t hash) noexcept { return hash >> 7; }
+		inline ctrl_t h2(std::size_t hash) noexcept {
+			return static_cast<ctrl_t>(hash & 0x7f);
+		}
+
+		// Capacities are of the form 2^n - 1, and at most 7/8 of the slots
+		// are filled.
+		inline constexpr std::size_t min_capacity = group::width - 1;
+
+		constexpr std::size_t max_growth(std::size_t capacity) noexcept {
+			return capacity - capacity / 8;
+		}
+
+		struct first_fn {
+			template<class P>
+			constexpr auto& operator()(P& p) const noexcept {
+				return p.first;
+			}
+		};
+
+		template<class T, class Proj>
+		using key_t = __uncvref<invoke_result_t<Proj&, const T&>>;
+
+		// A key of type Q is hashed and compared as it is if it is a K, or
+		// if it is known to hash like K.
+		template<class Q, class K>
+		META_CONCEPT transparent_key = Same<Q, K> ||
+			(ext::enable_hash_lookup<K, Q> && ext::Hashable<Q> &&
+			 EqualityComparableWith<const K&, const Q&>);
+
+		// A key type Q may be used to look up elements with key type K if
+		// it is transparent, or converts to K.
+		template<class Q, class K>
+		META_CONCEPT lookup_key = transparent_key<Q, K> ||
+			ConvertibleTo<const Q&, K>;
+
+		template<MoveConstructible T, class Proj, bool MutableElements>
+		requires CopyConstructible<Proj> &&
+			Invocable<Proj&, const T&> &&
+			ext::Hashable<key_t<T, Proj>> &&
+			EqualityComparable<key_t<T, Proj>>
+		class table {
+			template<bool Const> class __iterator;
+		public:
+			using value_type = T;
+			using key_type = key_t<T, Proj>;
+			using hasher = __hash::__fn;
+			using key_equal = equal_to;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using iterator = __iterator<!MutableElements>;
+			using const_iterator = __iterator<true>;
+
+			table() = default;
+			explicit table(Proj proj) : proj_(std::move(proj)) {}
+
+			template<InputRange R>
+			requires !DerivedFrom<__uncvref<R>, table> &&
+				ConvertibleTo<iter_reference_t<iterator_t<R>>, T>
+			explicit table(R&& r, Proj proj = {})
+			: proj_(std::move(proj))
+			{ insert(std::forward<R>(r)); }
+
+			// Braced lists of elements - {{"a", 1}, {"b", 2}} for a map - and
+			// of values that convert to them.
+			table(std::initializer_list<T> il, Proj proj = {})
+			requires CopyConstructible<T>
+			: proj_(std::move(proj))
+			{ insert(il); }
+			template<class U>
+			requires ConvertibleTo<const U&, T>
+			table(std::initializer_list<U> il, Proj proj = {})
+			: proj_(std::move(proj))
+			{ insert(il); }
+
+			table(const table& that) requires CopyConstructible<T>
+			: proj_(that.proj_)
+			{
+				reserve(that.size());
+				for (auto& e : that) {
+					emplace_new(hash_of(__stl2::invoke(proj_, e)), e);
+				}
+			}
+			table(table&& that) noexcept
+			: ctrl_(std::exchange(that.ctrl_, const_cast<ctrl_t*>(empty_group)))
+			, slots_(std::exchange(that.slots_, nullptr))
+			, size_(std::exchange(that.size_, 0))
+			, capacity_(std::exchange(that.capacity_, 0))
+			, growth_left_(std::exchange(that.growth_left_, 0))
+			, proj_(that.proj_)
+			{}
+
+			table& operator=(table that) noexcept {
+				swap(that);
+				return *this;
+			}
+
+			~table() {
+				destroy_elements();
+				deallocate();
+			}
+
+			void swap(table& that) noexcept {
+				using std::swap;
+				swap(ctrl_, that.ctrl_);
+				swap(slots_, that.slots_);
+				swap(size_, that.size_);
+				swap(capacity_, that.capacity_);
+				swap(growth_left_, that.growth_left_);
+				swap(proj_, that.proj_);
+			}
+			friend void swap(table& x, table& y) noexcept { x.swap(y); }
+
+			iterator begin() noexcept { return make_iterator<iterator>(0, true); }
+			const_iterator begin() const noexcept {
+				return make_iterator<const_iterator>(0, true);
+			}
+			iterator end() noexcept { return make_iterator<iterator>(capacity_); }
+			const_iterator end() const noexcept {
+				return make_iterator<const_iterator>(capacity_);
+			}
+
+			bool empty() const noexcept { return size_ == 0; }
+			size_type size() const noexcept { return size_; }
+			size_type capacity() const noexcept { return capacity_; }
+			float load_factor() const noexcept {
+				return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+			}
+
+			// Make room for n elements without growing.
+			void reserve(size_type n) {
+				if (n <= size_ + growth_left_) return;
+				auto cap = std::max(capacity_, min_capacity);
+				while (max_growth(cap) < n) cap = cap * 2 + 1;
+				resize(cap);
+			}
+
+			void clear() noexcept {
+				destroy_elements();
+				size_ = 0;
+				if (capacity_) {
+					reset_ctrl();
+					growth_left_ = max_growth(capacity_);
+				}
+			}
+
+			std::pair<iterator, bool> insert(const T& t)
+			requires CopyConstructible<T>
+			{ return insert_impl(t); }
+			std::pair<iterator, bool> insert(T&& t)
+			{ return insert_impl(std::move(t)); }
+
+			// Insert the elements of r, reserving room for all of them up
+			// front if the length of r can be determined without consuming it.
+			template<InputRange R>
+			requires ConvertibleTo<iter_reference_t<iterator_t<R>>, T>
+			void insert(R&& r) {
+				if constexpr (ForwardRange<R> || SizedRange<R>) {
+					reserve(size_ + static_cast<size_type>(__stl2::distance(r)));
+				}
+				auto first = __stl2::begin(r);
+				const auto last = __stl2::end(r);
+				for (; first != last; ++first) {
+					insert_impl(*first);
+				}
+			}
+			void insert(std::initializer_list<T> il)
+			requires CopyConstructible<T>
+			{
+				reserve(size_ + il.size());
+				for (auto& t : il) insert_impl(t);
+			}
+			template<class U>
+			requires ConvertibleTo<const U&, T>
+			void insert(std::initializer_list<U> il)
+			{
+				reserve(size_ + il.size());
+				for (auto& t : il) insert_impl(t);
+			}
+
+			template<class... Args>
+			requires Constructible<T, Args...>
+			std::pair<iterator, bool> emplace(Args&&... args) {
+				return insert_impl(T(std::forward<Args>(args)...));
+			}
+
+			template<lookup_key<key_type> Q>
+			iterator find(const Q& key) {
+				const auto i = find_index(key);
+				return i == npos ? end() : make_iterator<iterator>(i);
+			}
+			template<lookup_key<key_type> Q>
+			const_iterator find(const Q& key) const {
+				const auto i = find_index(key);
+				return i == npos ? end() : make_iterator<const_iterator>(i);
+			}
+			template<lookup_key<key_type> Q>
+			bool contains(const Q& key) const {
+				return find_index(key) != npos;
+			}
+			template<lookup_key<key_type> Q>
+			size_type count(const Q& key) const {
+				return contains(key) ? 1 : 0;
+			}
+
+			template<lookup_key<key_type> Q>
+			size_type erase(const Q& key) {
+				const auto i = find_index(key);
+				if (i == npos) return 0;
+				erase_at(i);
+				return 1;
+			}
+			iterator erase(const_iterator pos) noexcept {
+				const auto i = static_cast<size_type>(pos.ctrl_ - ctrl_);
+				STL2_EXPECT(i < capacity_ && ctrl_[i] >= 0);
+				erase_at(i);
+				return make_iterator<iterator>(i, true);
+			}
+			iterator erase(iterator pos) noexcept
+			requires MutableElements
+			{ return erase(const_iterator{pos}); }
+
+		protected:
+			static constexpr size_type npos = static_cast<size_type>(-1);
+
+			// Lookups call ext::hash, the projection and the key's
+			// operator==, any of which may throw.
+			template<class K>
+			static std::size_t hash_of(const K& key) {
+				return ext::hash(key);
+			}
+
+			template<class Q>
+			size_type find_index(const Q& key) const {
+				if constexpr (transparent_key<Q, key_type>) {
+					return find_index(key, hash_of(key));
+				} else {
+					const key_type k(key);
+					return find_index(k, hash_of(k));
+				}
+			}
+
+			template<class Q>
+			size_type find_index(const Q& key, std::size_t hash) const {
+				auto pos = h1(hash) & capacity_;
+				for (std::size_t stride = 0;;) {
+					const group g{ctrl_ + pos};
+					for (auto m = g.match(h2(hash)); m; m &= m - 1) {
+						const auto i = (pos + lowest(m)) & capacity_;
+						if (__stl2::invoke(proj_, slots_[i]) == key) return i;
+					}
+					if (g.match_empty()) return npos;
+					stride += group::width;
+					pos = (pos + stride) & capacity_;
+				}
+			}
+
+			// Construct a new element from args in a free slot for a key
+			// with the given hash, which must not be present. Grows the
+			// table if necessary.
+			template<class... Args>
+			size_type emplace_new(std::size_t hash, Args&&... args) {
+				auto i = find_first_non_full(hash);
+				if (growth_left_ == 0 && ctrl_[i] != ctrl_deleted) {
+					grow();
+					i = find_first_non_full(hash);
+				}
+				::new (static_cast<void*>(slots_ + i)) T(std::forward<Args>(args)...);
+				++size_;
+				growth_left_ -= ctrl_[i] == ctrl_empty;
+				set_ctrl(i, h2(hash));
+				return i;
+			}
+
+			template<class It>
+			It make_iterator(size_type i, bool skip = false) const noexcept {
+				It it{ctrl_ + i, slots_ + i};
+				if (skip) it.skip_empty_or_deleted();
+				return it;
+			}
+
+		private:
+			ctrl_t* ctrl_ = const_cast<ctrl_t*>(empty_group);
+			T* slots_ = nullptr;
+			size_type size_ = 0;
+			size_type capacity_ = 0;
+			size_type growth_left_ = 0;
+			Proj proj_ {};
+
+			template<class U>
+			std::pair<iterator, bool> insert_impl(U&& u) {
+				if constexpr (!Same<__uncvref<U>, T>) {
+					// Hash the key of the element, not of its source.
+					return insert_impl(T(std::forward<U>(u)));
+				} else {
+					auto&& key = __stl2::invoke(proj_, std::as_const(u));
+					const auto hash = hash_of(key);
+					auto i = find_index(key, hash);
+					if (i != npos) return {make_iterator<iterator>(i), false};
+					i = emplace_new(hash, std::forward<U>(u));
+					return {make_iterator<iterator>(i), true};
+				}
+			}
+
+			size_type find_first_non_full(std::size_t hash) const noexcept {
+				auto pos = h1(hash) & capacity_;
+				for (std::size_t stride = 0;;) {
+					if (auto m = group{ctrl_ + pos}.match_empty_or_deleted()) {
+						return (pos + lowest(m)) & capacity_;
+					}
+					stride += group::width;
+					pos = (pos + stride) & capacity_;
+				}
+			}
+
+			// Set the control byte for slot i, and its clone past the
+			// sentinel if i is in the first group.
+			void set_ctrl(size_type i, ctrl_t c) noexcept {
+				ctrl_[i] = c;
+				ctrl_[((i - (group::width - 1)) & capacity_) +
+					((group::width - 1) & capacity_)] = c;
+			}
+
+			void reset_ctrl() noexcept {
+				std::memset(ctrl_, ctrl_empty, capacity_ + group::width);
+				ctrl_[capacity_] = ctrl_sentinel;
+			}
+
+			void erase_at(size_type i) noexcept {
+				slots_[i].~T();
+				--size_;
+				// If no probe sequence could have passed over slot i while
+				// it was full - there is an empty slot within a group's
+				// width on either side - it can become empty rather than
+				// deleted.
+				const auto before = (i - group::width) & capacity_;
+				const auto empty_after = group{ctrl_ + i}.match_empty();
+				const auto empty_before = group{ctrl_ + before}.match_empty();
+				const bool was_never_full = empty_before && empty_after &&
+					(__builtin_ctz(empty_after) + leading_zeros(empty_before)) <
+						group::width;
+				set_ctrl(i, was_never_full ? ctrl_empty : ctrl_deleted);
+				growth_left_ += was_never_full;
+			}
+
+			void grow() {
+				if (capacity_ == 0) {
+					resize(min_capacity);
+				} else if (size_ <= max_growth(capacity_) / 2) {
+					// Mostly tombstones: rehash in a table of the same size.
+					resize(capacity_);
+				} else {
+					resize(capacity_ * 2 + 1);
+				}
+			}
+
+			void resize(size_type new_capacity) {
+				STL2_EXPECT(max_growth(new_capacity) >= size_);
+				auto old_ctrl = ctrl_;
+				auto old_slots = slots_;
+				const auto old_capacity = capacity_;
+
+				auto new_ctrl = std::make_unique<ctrl_t[]>(new_capacity + group::width);
+				slots_ = std::allocator<T>{}.allocate(new_capacity);
+				ctrl_ = new_ctrl.release();
+				capacity_ = new_capacity;
+				reset_ctrl();
+				growth_left_ = max_growth(new_capacity) - size_;
+
+				for (size_type i = 0; i < old_capacity; ++i) {
+					if (old_ctrl[i] < 0) continue;
+					const auto hash = hash_of(__stl2::invoke(proj_, old_slots[i]));
+					const auto j = find_first_non_full(hash);
+					set_ctrl(j, h2(hash));
+					::new (static_cast<void*>(slots_ + j)) T(std::move(old_slots[i]));
+					old_slots[i].~T();
+				}
+				if (old_capacity) {
+					std::allocator<T>{}.deallocate(old_slots, old_capacity);
+					delete[] old_ctrl;
+				}
+			}
+
+			void destroy_elements() noexcept {
+				if constexpr (!std::is_trivially_destructible_v<T>) {
+					for (size_type i = 0; i < capacity_; ++i) {
+						if (ctrl_[i] >= 0) slots_[i].~T();
+					}
+				}
+			}
+
+			void deallocate() noexcept {
+				if (capacity_) {
+					std::allocator<T>{}.deallocate(slots_, capacity_);
+					delete[] ctrl_;
+				}
+			}
+		};
+
+		template<MoveConstructible T, class Proj, bool MutableElements>
+		requires CopyConstructible<Proj> &&
+			Invocable<Proj&, const T&> &&
+			ext::Hashable<key_t<T, Proj>> &&
+			EqualityComparable<key_t<T, Proj>>
+		template<bool Const>
+		class table<T, Proj, MutableElements>::__iterator {
+			friend table;
+			friend __iterator<!Const>;
+
+			ctrl_t* ctrl_ = nullptr;
+			T* slot_ = nullptr;
+
+			__iterator(ctrl_t* ctrl, T* slot) noexcept
+			: ctrl_(ctrl), slot_(slot) {}
+
+			void skip_empty_or_deleted() noexcept {
+				while (*ctrl_ < ctrl_sentinel) {
+					const auto n = group{ctrl_}.count_leading_empty_or_deleted();
+					ctrl_ += n;
+					slot_ += n;
+				}
+			}
+		public:
+			using iterator_category = __stl2::forward_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using reference = meta::if_c<Const, const T&, T&>;
+			using pointer = meta::if_c<Const, const T*, T*>;
+
+			__iterator() = default;
+
+			__iterator(const __iterator<!Const>& that) noexcept
+			requires Const
+			: ctrl_(that.ctrl_), slot_(that.slot_) {}
+
+			reference operator*() const noexcept {
+				STL2_EXPECT(*ctrl_ >= 0);
+				return *slot_;
+			}
+			pointer operator->() const noexcept {
+				return slot_;
+			}
+
+			__iterator& operator++() noexcept {
+				STL2_EXPECT(*ctrl_ >= 0);
+				++ctrl_;
+				++slot_;
+				skip_empty_or_deleted();
+				return *this;
+			}
+			__iterator operator++(int) noexcept {
+				auto tmp = *this;
+				++*this;
+				return tmp;
+			}
+
+			friend bool operator==(const __iterator& x, const __iterator& y) noexcept {
+				return x.ctrl_ == y.ctrl_;
+			}
+			friend bool operator!=(const __iterator& x, const __iterator& y) noexcept {
+				return !(x == y);
+			}
+		};
+	}
+
+	namespace ext {
+		///////////////////////////////////////////////////////////////////////
+		// flat_hash_set [Extension]
+		//
+		template<Movable T, class Proj = identity>
+		class flat_hash_set : public __flat_hash::table<T, Proj, false> {
+			using base_t = __flat_hash::table<T, Proj, false>;
+		public:
+			using base_t::base_t;
+			flat_hash_set() = default;
+		};
+
+		template<InputRange R>
+		flat_hash_set(R&&) -> flat_hash_set<iter_value_t<iterator_t<R>>>;
+
+		template<InputRange R, class Proj>
+		flat_hash_set(R&&, Proj) -> flat_hash_set<iter_value_t<iterator_t<R>>, Proj>;
+
+		///////////////////////////////////////////////////////////////////////
+		// flat_hash_map [Extension]
+		//
+		template<Movable K, Movable V>
+		class flat_hash_map
+		: public __flat_hash::table<std::pair<const K, V>, __flat_hash::first_fn, true> {
+			using base_t =
+				__flat_hash::table<std::pair<const K, V>, __flat_hash::first_fn, true>;
+		public:
+			using mapped_type = V;
+			using typename base_t::iterator;
+			using typename base_t::key_type;
+
+			using base_t::base_t;
+			flat_hash_map() = default;
+
+			// Insert an element constructed from k and args if there is no
+			// element with key k. Does not move from k or args otherwise.
+			template<class... Args>
+			requires Constructible<V, Args...>
+			std::pair<iterator, bool> try_emplace(const K& k, Args&&... args)
+			requires CopyConstructible<K>
+			{ return try_emplace_impl(k, std::forward<Args>(args)...); }
+			template<class... Args>
+			requires Constructible<V, Args...>
+			std::pair<iterator, bool> try_emplace(K&& k, Args&&... args)
+			{ return try_emplace_impl(std::move(k), std::forward<Args>(args)...); }
+
+			template<class M>
+			requires Assignable<V&, M> && Constructible<V, M>
+			std::pair<iterator, bool> insert_or_assign(const K& k, M&& m)
+			requires CopyConstructible<K>
+			{
+				auto result = try_emplace(k, std::forward<M>(m));
+				if (!result.second) result.first->second = std::forward<M>(m);
+				return result;
+			}
+			template<class M>
+			requires Assignable<V&, M> && Constructible<V, M>
+			std::pair<iterator, bool> insert_or_assign(K&& k, M&& m)
+			{
+				auto result = try_emplace(std::move(k), std::forward<M>(m));
+				if (!result.second) result.first->second = std::forward<M>(m);
+				return result;
+			}
+
+			V& operator[](const K& k)
+			requires CopyConstructible<K> && DefaultConstructible<V>
+			{ return try_emplace(k).first->second; }
+			V& operator[](K&& k)
+			requires DefaultConstructible<V>
+			{ return try_emplace(std::move(k)).first->second; }
+
+		private:
+			template<class KK, class... Args>
+			std::pair<iterator, bool> try_emplace_impl(KK&& k, Args&&... args) {
+				const auto hash = base_t::hash_of(k);
+				auto i = base_t::find_index(k, hash);
+				if (i != base_t::npos) {
+					return {base_t::template make_iterator<iterator>(i), false};
+				}
+				i = base_t::emplace_new(hash, std::piecewise_construct,
+					std::forward_as_tuple(std::forward<KK>(k)),
+					std::forward_as_tuple(std::forward<Args>(args)...));
+				return {base_t::template make_iterator<iterator>(i), true};
+			}
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,92 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_FUNCTIONAL_CHAR_SET_HPP
+#define STL2_DETAIL_FUNCTIONAL_CHAR_SET_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// char_set [Extension]
+// A set of byte values, held as a table of 256 bits, and the unary
+// predicate that is true of its members: the characters of type char,
+// signed char, unsigned char or std::byte whose unsigned char values are
+// in the set. find_if, count_if and split_view recognize it, and with
+// AVX2 test 32 characters at a time against its table.
+//
+// The table is laid out for those tests: the bit for c is bit
+// (c >> 4) % 8 of the byte c % 16 of row c / 128, so that each row is
+// indexed by the low nibble of a character with one byte shuffle.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class C>
+		META_CONCEPT __char_like = (std::is_integral_v<C> && sizeof(C) == 1 &&
+			!Same<C, bool>) || Same<C, std::byte>;
+
+		class __simd_char_set;
+	}
+
+	namespace ext {
+		class char_set {
+		public:
+			char_set() = default;
+
+			// The characters of the null-terminated string s.
+			constexpr explicit char_set(const char* s) noexcept {
+				for (; *s; ++s) insert(*s);
+			}
+
+			// The characters of s.
+			constexpr explicit char_set(std::string_view s) noexcept {
+				for (char c : s) insert(c);
+			}
+
+			template<detail::__char_like C>
+			constexpr void insert(C c) noexcept {
+				const auto u = static_cast<unsigned char>(c);
+				rows_[u / 128][u % 16] |= static_cast<unsigned char>(1u << (u >> 4) % 8);
+			}
+
+			template<detail::__char_like C>
+			constexpr bool contains(C c) const noexcept {
+				const auto u = static_cast<unsigned char>(c);
+				return (rows_[u / 128][u % 16] >> (u >> 4) % 8) & 1;
+			}
+
+			template<detail::__char_like C>
+			constexpr bool operator()(C c) const noexcept {
+				return contains(c);
+			}
+
+			friend constexpr bool operator==(const char_set& x, const char_set& y) noexcept {
+				for (std::size_t i = 0; i < 32; ++i) {
+					if (x.rows_[i / 16][i % 16] != y.rows_[i / 16][i % 16]) return false;
+				}
+				return true;
+			}
+			friend constexpr bool operator!=(const char_set& x, const char_set& y) noexcept {
+				return !(x == y);
+			}
+
+		private:
+			friend detail::__simd_char_set;
+
+			alignas(16) unsigned char rows_[2][16] {};
+		};
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
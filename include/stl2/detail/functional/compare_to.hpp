@@ -0,0 +1,83 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_FUNCTIONAL_COMPARE_TO_HPP
+#define STL2_DETAIL_FUNCTIONAL_COMPARE_TO_HPP
+
+#include <type_traits>
+#include <utility>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/function.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/functional/comparisons.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// compare_to [Extension]
+// The unary predicate Comp{}(x, value), for a comparison function object
+// Comp: ext::lt(v) is true of the x with x < v, and ext::le, ext::gt,
+// ext::ge, ext::eq and ext::ne likewise for <=, >, >=, == and !=. Unlike
+// an equivalent lambda, its comparison and value are visible to the
+// algorithms, which may test many elements at once when they and value
+// are of the same arithmetic type.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Comparisons that, of arithmetic values, cannot throw.
+		template<class Comp>
+		META_CONCEPT __builtin_comparison = Same<Comp, less> ||
+			Same<Comp, greater> || Same<Comp, less_equal> ||
+			Same<Comp, greater_equal> || Same<Comp, equal_to> ||
+			Same<Comp, not_equal_to>;
+	}
+
+	namespace ext {
+		template<class Comp, class T>
+		struct compare_to {
+			T value;
+
+			template<class U>
+			requires Predicate<const Comp&, U, const T&>
+			constexpr bool operator()(U&& x) const
+			noexcept(detail::__builtin_comparison<Comp> &&
+				std::is_arithmetic_v<__uncvref<U>> && std::is_arithmetic_v<T>)
+			{
+				return Comp{}(std::forward<U>(x), value);
+			}
+		};
+
+		template<MoveConstructible T>
+		constexpr compare_to<less, T> lt(T value) {
+			return {std::move(value)};
+		}
+		template<MoveConstructible T>
+		constexpr compare_to<less_equal, T> le(T value) {
+			return {std::move(value)};
+		}
+		template<MoveConstructible T>
+		constexpr compare_to<greater, T> gt(T value) {
+			return {std::move(value)};
+		}
+		template<MoveConstructible T>
+		constexpr compare_to<greater_equal, T> ge(T value) {
+			return {std::move(value)};
+		}
+		template<MoveConstructible T>
+		constexpr compare_to<equal_to, T> eq(T value) {
+			return {std::move(value)};
+		}
+		template<MoveConstructible T>
+		constexpr compare_to<not_equal_to, T> ne(T value) {
+			return {std::move(value)};
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
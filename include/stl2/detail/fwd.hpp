@@ -24,6 +24,9 @@
  #if defined(__GNUC__)
   #define STL2_HAS_BUILTIN_unreachable 1
  #endif // __GNUC__
+ #if defined(__GNUC__) && __GNUC__ >= 9
+  #define STL2_HAS_BUILTIN_is_constant_evaluated 1
+ #endif // __GNUC__ >= 9
 #endif // __clang__
 
 #ifndef STL2_WORKAROUND_GCC_69096
@@ -191,6 +194,19 @@ STL2_OPEN_NAMESPACE {
 		inline constexpr priority_tag<4> max_priority_tag{};
 	}
 
+	namespace detail {
+		// Is the call being evaluated as a constant expression? Fast paths
+		// that are not constexpr - intrinsics, memcpy - check this first,
+		// and are never taken when it cannot be told.
+		constexpr bool __is_constant_evaluated() noexcept {
+#if STL2_HAS_BUILTIN(is_constant_evaluated)
+			return __builtin_is_constant_evaluated();
+#else
+			return true;
+#endif
+		}
+	}
+
 	struct __niebloid {
 		explicit __niebloid() = default;
 		__niebloid(const __niebloid&) = delete;
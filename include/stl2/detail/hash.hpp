@@ -12,35 +12,295 @@
 #ifndef STL2_DETAIL_HASH_HPP
 #define STL2_DETAIL_HASH_HPP
 
+#include <climits>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/tuple_like.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
 
 ///////////////////////////////////////////////////////////////////////////
 // Hash machinery.
 //
 STL2_OPEN_NAMESPACE {
+	///////////////////////////////////////////////////////////////////////////
+	// Hash primitives
+	// The multiply-and-fold mixer and the byte hash are those of wyhash
+	// (final version 4) by Wang Yi, which is in the public domain.
+	//
+	namespace __hash {
+		__extension__ typedef unsigned __int128 __uint128;
+
+		inline constexpr std::uint64_t secret[4] = {
+			0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+			0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull
+		};
+
+		// 64x64->128 bit multiply, folded to 64 bits by xor
+		constexpr std::uint64_t mum(std::uint64_t a, std::uint64_t b) noexcept {
+			__uint128 r = a;
+			r *= b;
+			return static_cast<std::uint64_t>(r) ^
+				static_cast<std::uint64_t>(r >> 64);
+		}
+
+		// Mix b into the hash value a.
+		constexpr std::uint64_t combine(std::uint64_t a, std::uint64_t b) noexcept {
+			__uint128 r = a ^ secret[0];
+			r *= b ^ secret[1];
+			return mum(static_cast<std::uint64_t>(r) ^ secret[0],
+				static_cast<std::uint64_t>(r >> 64) ^ secret[1]);
+		}
+
+		inline std::uint64_t read8(const unsigned char* p) noexcept {
+			std::uint64_t v;
+			std::memcpy(&v, p, 8);
+			return v;
+		}
+		inline std::uint64_t read4(const unsigned char* p) noexcept {
+			std::uint32_t v;
+			std::memcpy(&v, p, 4);
+			return v;
+		}
+		inline std::uint64_t read3(const unsigned char* p, std::size_t k) noexcept {
+			return (std::uint64_t{p[0]} << 16) | (std::uint64_t{p[k >> 1]} << 8) |
+				p[k - 1];
+		}
+
+		// Hash the n bytes at key in a single pass.
+		inline std::uint64_t
+		bytes(const void* key, std::size_t n, std::uint64_t seed) noexcept {
+			auto p = static_cast<const unsigned char*>(key);
+			seed ^= mum(seed ^ secret[0], secret[1]);
+			std::uint64_t a, b;
+			if (n <= 16) {
+				if (n >= 4) {
+					const auto k = (n >> 3) << 2;
+					a = (read4(p) << 32) | read4(p + k);
+					b = (read4(p + n - 4) << 32) | read4(p + n - 4 - k);
+				} else if (n > 0) {
+					a = read3(p, n);
+					b = 0;
+				} else {
+					a = b = 0;
+				}
+			} else {
+				auto i = n;
+				if (i > 48) {
+					auto seed1 = seed, seed2 = seed;
+					do {
+						seed = mum(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+						seed1 = mum(read8(p + 16) ^ secret[2], read8(p + 24) ^ seed1);
+						seed2 = mum(read8(p + 32) ^ secret[3], read8(p + 40) ^ seed2);
+						p += 48;
+						i -= 48;
+					} while (i > 48);
+					seed ^= seed1 ^ seed2;
+				}
+				while (i > 16) {
+					seed = mum(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+					p += 16;
+					i -= 16;
+				}
+				a = read8(p + i - 16);
+				b = read8(p + i - 8);
+			}
+			__uint128 r = a ^ secret[1];
+			r *= b ^ seed;
+			return mum(static_cast<std::uint64_t>(r) ^ secret[0] ^ n,
+				static_cast<std::uint64_t>(r >> 64) ^ secret[1]);
+		}
+
+		template<class T>
+		META_CONCEPT std_hashable = requires(const T& e) {
+			typename std::hash<T>;
+			{ std::hash<T>{}(e) } -> std::size_t;
+		};
+
+		// Poison pill for the customization point
+		template<class T> void hash_value(const T&) = delete;
+
+		template<class T>
+		META_CONCEPT has_customization = requires(const T& t) {
+			{ hash_value(t) } -> std::size_t;
+		};
+
+		// Scalars are hashed by mixing their value.
+		template<class T>
+		META_CONCEPT scalar = sizeof(T) <= sizeof(std::uint64_t) &&
+			(std::is_integral_v<T> || std::is_enum_v<T> ||
+			 std::is_pointer_v<T> || std::is_null_pointer_v<T> ||
+			 std::is_floating_point_v<T>);
+
+		// Contiguous ranges of scalars with unique object representations -
+		// integers, enumerations, and pointers that would themselves be
+		// hashed by value - are hashed as a single block of bytes.
+		template<class R>
+		META_CONCEPT contiguous_bytes =
+			ContiguousRange<const R> && SizedRange<const R> &&
+			scalar<iter_value_t<iterator_t<const R>>> &&
+			!has_customization<iter_value_t<iterator_t<const R>>> &&
+			std::has_unique_object_representations_v<
+				iter_value_t<iterator_t<const R>>>;
+
+		template<class T, class F, std::size_t... Is>
+		constexpr bool tuple_elements_hashable(std::index_sequence<Is...>) {
+			return (Invocable<const F&, const std::tuple_element_t<Is, T>&> && ...);
+		}
+
+		template<class T, class F>
+		META_CONCEPT hashable_tuple =
+			requires { std::tuple_size<T>::value; } &&
+			tuple_elements_hashable<T, F>(
+				std::make_index_sequence<std::tuple_size<T>::value>{});
+
+		template<class R, class F>
+		META_CONCEPT hashable_range = ForwardRange<const R> &&
+			Invocable<const F&, iter_reference_t<iterator_t<const R>>>;
+
+		// Hashed containers - those with a hasher or a key_equal - iterate
+		// in an order that depends on their history, not on their
+		// elements, so equal containers need not agree on it.
+		template<class R>
+		META_CONCEPT unordered_range =
+			requires { typename R::hasher; } || requires { typename R::key_equal; };
+
+		// Hash, in order of preference:
+		// * a user-provided hash_value found by ADL,
+		// * scalars by value,
+		// * contiguous ranges of such scalars as bytes,
+		// * other ranges, and then tuple-like types, element by element,
+		//   in order - or, for hashed containers, by summing the hashes of
+		//   their elements, in whatever order they come,
+		// * anything else with std::hash.
+		// Equal tuples and equal ranges of the same kind hash equally:
+		// e.g., a span, a subrange, and a vector of the same ints agree.
+		// Contiguous and other ranges are not of a kind: a list of those
+		// ints hashes differently.
+		struct __fn {
+			template<class T>
+			requires has_customization<T> || scalar<T> ||
+				contiguous_bytes<T> || hashable_range<T, __fn> ||
+				hashable_tuple<T, __fn> || std_hashable<T>
+			std::size_t operator()(const T& t) const {
+				if constexpr (has_customization<T>) {
+					return hash_value(t);
+				} else if constexpr (scalar<T>) {
+					std::uint64_t bits = 0;
+					if constexpr (std::is_floating_point_v<T>) {
+						// +0.0 and -0.0 compare equal. Clear the sign of a zero in
+						// the representation: -ffast-math folds t == 0 ? 0 : t to t.
+						constexpr std::uint64_t sign =
+							std::uint64_t{1} << (sizeof(T) * CHAR_BIT - 1);
+						std::memcpy(&bits, &t, sizeof(T));
+						if ((bits & ~sign) == 0) bits = 0;
+					} else if constexpr (std::is_pointer_v<T>) {
+						bits = reinterpret_cast<std::uintptr_t>(t);
+					} else if constexpr (!std::is_null_pointer_v<T>) {
+						bits = static_cast<std::uint64_t>(t);
+					}
+					return static_cast<std::size_t>(combine(bits, 0));
+				} else if constexpr (contiguous_bytes<T>) {
+					using V = iter_value_t<iterator_t<const T>>;
+					return static_cast<std::size_t>(bytes(__stl2::data(t),
+						static_cast<std::size_t>(__stl2::size(t)) * sizeof(V), 0));
+				} else if constexpr (hashable_range<T, __fn>) {
+					std::uint64_t h = 0;
+					std::uint64_t n = 0;
+					auto first = __stl2::begin(t);
+					const auto last = __stl2::end(t);
+					for (; first != last; ++first, ++n) {
+						if constexpr (unordered_range<T>) {
+							h += (*this)(*first);
+						} else {
+							h = combine(h, (*this)(*first));
+						}
+					}
+					return static_cast<std::size_t>(combine(h, n));
+				} else if constexpr (hashable_tuple<T, __fn>) {
+					return tuple_hash(t,
+						std::make_index_sequence<std::tuple_size<T>::value>{});
+				} else {
+					return static_cast<std::size_t>(combine(std::hash<T>{}(t), 0));
+				}
+			}
+
+		private:
+			template<class T, std::size_t... Is>
+			std::size_t tuple_hash(const T& t, std::index_sequence<Is...>) const {
+				std::uint64_t h = sizeof...(Is);
+				((h = combine(h, (*this)(detail::adl_get<Is>(t)))), ...);
+				return static_cast<std::size_t>(h);
+			}
+		};
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	// hash [Extension]
+	// A customization point that hashes with a strong mixing function.
+	// Users customize by providing hash_value(const T&) for ADL to find.
+	//
+	namespace ext {
+		inline constexpr __hash::__fn hash {};
+	}
+
 	///////////////////////////////////////////////////////////////////////////
 	// Hashable [Extension]
-	// Extremely limited since std::hash is not SFINAE-friendly.
 	//
 	namespace ext {
 		template<class T>
 		META_CONCEPT Hashable = requires(const T& e) {
-			typename std::hash<T>;
-			{ std::hash<T>{}(e) } -> std::size_t;
+			{ hash(e) } -> std::size_t;
 		};
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	// enable_hash_lookup [Extension]
+	// Opt-in: may a key of type Q find an equal key of type K in a hashed
+	// container by way of its own hash? True only where hash(q) == hash(k)
+	// whenever q == k - e.g., strings and string views of the same
+	// characters, both hashed as their bytes. Other lookup keys are first
+	// converted to K. Users may specialize for their own types.
+	//
+	namespace ext {
+		template<class K, class Q>
+		inline constexpr bool enable_hash_lookup = false;
+
+		template<class C, class T, class A>
+		inline constexpr bool enable_hash_lookup<std::basic_string<C, T, A>,
+			std::basic_string_view<C, T>> = true;
+		template<class C, class T, class A>
+		inline constexpr bool enable_hash_lookup<std::basic_string_view<C, T>,
+			std::basic_string<C, T, A>> = true;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	// hash_bytes [Extension]
+	// Hash a contiguous block of bytes in one pass.
+	//
+	namespace ext {
+		inline std::size_t
+		hash_bytes(const void* p, std::size_t n, std::size_t seed = 0) noexcept {
+			return static_cast<std::size_t>(__hash::bytes(p, n, seed));
+		}
+	}
+
 	///////////////////////////////////////////////////////////////////////////
 	// hash_combine [Extension]
-	// Stolen from Boost.
 	//
 	namespace ext {
 		template<Hashable T>
 		inline void hash_combine(std::size_t& seed, const T& v) {
-			std::hash<T> hasher;
-			seed ^= hasher(v) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+			seed = static_cast<std::size_t>(__hash::combine(seed, hash(v)));
 		}
 	}
 } STL2_CLOSE_NAMESPACE
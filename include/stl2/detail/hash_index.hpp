@@ -0,0 +1,183 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_HASH_INDEX_HPP
+#define STL2_DETAIL_HASH_INDEX_HPP
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// hash_index
+// An open-addressing hash table of positions in a range, keyed on the
+// projections of the elements they denote. The table stores iterators
+// rather than keys, so it neither copies nor requires copyable keys.
+// Linear probing; the load factor is kept at or below one half. Each slot
+// caches the full hash of its key (zero marks an empty slot) and carries a
+// count for callers that treat the indexed range as a multiset.
+//
+// Tables that are reserved for their final size up front - as the
+// algorithms do whenever the input length is known - make exactly one
+// allocation of at most 4n slots and never rehash.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		inline constexpr std::size_t __hash_index_occupied =
+			~(std::numeric_limits<std::size_t>::max() >> 1);
+
+		// The hash of key, tagged so that it is never zero.
+		template<ext::Hashable K>
+		std::size_t hash_index_key(const K& key) {
+			return ext::hash(key) | __hash_index_occupied;
+		}
+
+		// A key of type Q may look up an index keyed on K if it hashes as a
+		// K would - because it is a K, or ext::enable_hash_lookup says so -
+		// or if it converts to K, in which case the converted key is hashed.
+		template<class Q, class K>
+		META_CONCEPT HashIndexLookup = Same<Q, K> ||
+			(ext::enable_hash_lookup<K, Q> && ext::Hashable<Q>) ||
+			ConvertibleTo<const Q&, K>;
+
+		// The tagged hash of key as a K.
+		template<class K, class Q>
+		requires HashIndexLookup<Q, K>
+		std::size_t hash_index_key_as(const Q& key) {
+			if constexpr (Same<Q, K> || ext::enable_hash_lookup<K, Q>) {
+				return hash_index_key(key);
+			} else {
+				return hash_index_key(static_cast<K>(key));
+			}
+		}
+
+		template<class I, class Proj>
+		META_CONCEPT HashIndexable = ForwardIterator<I> &&
+			ext::Hashable<iter_value_t<projected<I, Proj>>> &&
+			IndirectRelation<equal_to, projected<I, Proj>>;
+
+		template<ForwardIterator I>
+		class hash_index {
+		public:
+			using difference_type = iter_difference_t<I>;
+
+			struct slot {
+				std::size_t hash = 0;
+				difference_type count = 0;
+				I pos {};
+			};
+
+			hash_index() = default;
+			explicit hash_index(std::size_t n) { reserve(n); }
+
+			std::size_t size() const noexcept { return size_; }
+			bool empty() const noexcept { return size_ == 0; }
+
+			// Make room for n positions without rehashing.
+			void reserve(std::size_t n) {
+				if (n == 0) return;
+				std::size_t cap = min_capacity;
+				while (cap / 2 < n) cap *= 2;
+				if (cap > slots_.size()) rehash(cap);
+			}
+
+			void clear() noexcept {
+				for (auto& s : slots_) s = slot{};
+				size_ = 0;
+			}
+
+			// Find the slot whose position satisfies eq among those with
+			// the tagged hash h, or return nullptr.
+			template<class Eq>
+			slot* find(std::size_t h, Eq eq) {
+				STL2_EXPECT(h & __hash_index_occupied);
+				if (slots_.empty()) return nullptr;
+				const auto mask = slots_.size() - 1;
+				for (auto i = h & mask;; i = (i + 1) & mask) {
+					auto& s = slots_[i];
+					if (s.hash == 0) return nullptr;
+					if (s.hash == h && eq(std::as_const(s.pos))) return &s;
+				}
+			}
+
+			// Find the slot for the key with tagged hash h, or occupy a new
+			// slot with pos and a count of zero. The bool is true if the slot
+			// is new.
+			template<class Eq>
+			std::pair<slot*, bool> insert(std::size_t h, const I& pos, Eq eq) {
+				STL2_EXPECT(h & __hash_index_occupied);
+				if (slots_.size() / 2 < size_ + 1) {
+					rehash(slots_.empty() ? min_capacity : slots_.size() * 2);
+				}
+				const auto mask = slots_.size() - 1;
+				for (auto i = h & mask;; i = (i + 1) & mask) {
+					auto& s = slots_[i];
+					if (s.hash == 0) {
+						s.hash = h;
+						s.pos = pos;
+						++size_;
+						return {&s, true};
+					}
+					if (s.hash == h && eq(std::as_const(s.pos))) return {&s, false};
+				}
+			}
+
+		private:
+			static constexpr std::size_t min_capacity = 16;
+
+			std::vector<slot> slots_;
+			std::size_t size_ = 0;
+
+			void rehash(std::size_t cap) {
+				std::vector<slot> old(cap);
+				old.swap(slots_);
+				const auto mask = cap - 1;
+				for (auto& s : old) {
+					if (s.hash == 0) continue;
+					auto i = s.hash & mask;
+					while (slots_[i].hash != 0) i = (i + 1) & mask;
+					slots_[i] = std::move(s);
+				}
+			}
+		};
+
+		// Index [first, last) as a multiset: one slot per distinct key, at
+		// its first occurrence, counting the occurrences of the key. On
+		// return, first == last.
+		template<ForwardIterator I, Sentinel<I> S, class Proj>
+		requires HashIndexable<I, Proj>
+		hash_index<I> hash_index_count(I& first, S last, Proj& proj) {
+			hash_index<I> index;
+			if constexpr (SizedSentinel<S, I>) {
+				index.reserve(static_cast<std::size_t>(last - first));
+			}
+			for (; first != last; ++first) {
+				auto&& key = __stl2::invoke(proj, *first);
+				auto [s, inserted] = index.insert(hash_index_key(key), first,
+					[&](const I& i) {
+						return __stl2::invoke(equal_to{}, key,
+							__stl2::invoke(proj, *i));
+					});
+				(void)inserted;
+				++s->count;
+			}
+			return index;
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
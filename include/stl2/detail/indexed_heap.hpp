@@ -0,0 +1,210 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_INDEXED_HEAP_HPP
+#define STL2_DETAIL_INDEXED_HEAP_HPP
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/heap_sift.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// indexed_heap [Extension]
+// A priority queue whose top is the greatest element under Comp and Proj.
+// push returns a handle that identifies the element until it is popped or
+// erased; through the handle the element can be updated or erased in
+// O(log n). The heap proper holds handles and is maintained by the sift
+// algorithms; the position of each handle is tracked in a side array.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<Movable T, class Comp = less, class Proj = identity,
+			std::size_t Arity = 2>
+		requires IndirectStrictWeakOrder<Comp, projected<const T*, Proj>> &&
+			(Arity >= 2)
+		class indexed_heap {
+		public:
+			using value_type = T;
+			using size_type = std::size_t;
+			using handle_type = std::size_t;
+			static constexpr std::size_t arity = Arity;
+
+			indexed_heap() = default;
+			explicit indexed_heap(Comp comp, Proj proj = {})
+			: comp_(std::move(comp)), proj_(std::move(proj)) {}
+
+			bool empty() const noexcept { return heap_.empty(); }
+			size_type size() const noexcept { return heap_.size(); }
+
+			void reserve(size_type n) {
+				heap_.reserve(n);
+				values_.reserve(n);
+				pos_.reserve(n);
+			}
+
+			void clear() noexcept {
+				heap_.clear();
+				values_.clear();
+				pos_.clear();
+				free_.clear();
+			}
+
+			const T& top() const {
+				STL2_EXPECT(!empty());
+				return values_[heap_.front()];
+			}
+			handle_type top_handle() const {
+				STL2_EXPECT(!empty());
+				return heap_.front();
+			}
+
+			// Does h denote an element currently in the heap?
+			bool contains(handle_type h) const noexcept {
+				return h < pos_.size() && pos_[h] != npos;
+			}
+
+			const T& operator[](handle_type h) const {
+				STL2_EXPECT(contains(h));
+				return values_[h];
+			}
+			// Modifications through the returned reference that change the
+			// element's order must be followed by update(h).
+			T& operator[](handle_type h) {
+				STL2_EXPECT(contains(h));
+				return values_[h];
+			}
+
+			handle_type push(const T& t) requires CopyConstructible<T> {
+				return emplace(t);
+			}
+			handle_type push(T&& t) {
+				return emplace(std::move(t));
+			}
+
+			template<class... Args>
+			requires Constructible<T, Args...>
+			handle_type emplace(Args&&... args) {
+				handle_type h;
+				if (free_.empty()) {
+					h = values_.size();
+					values_.emplace_back(std::forward<Args>(args)...);
+					pos_.push_back(npos);
+				} else {
+					h = free_.back();
+					values_[h] = T(std::forward<Args>(args)...);
+					free_.pop_back();
+				}
+				pos_[h] = heap_.size();
+				heap_.push_back(h);
+				sift_up(pos_[h]);
+				return h;
+			}
+
+			void pop() {
+				STL2_EXPECT(!empty());
+				erase(heap_.front());
+			}
+
+			// Restore heap order after the element denoted by h has changed.
+			void update(handle_type h) {
+				STL2_EXPECT(contains(h));
+				restore(pos_[h]);
+			}
+			void update(handle_type h, const T& t) requires Copyable<T> {
+				(*this)[h] = t;
+				restore(pos_[h]);
+			}
+			void update(handle_type h, T&& t) {
+				(*this)[h] = std::move(t);
+				restore(pos_[h]);
+			}
+
+			void erase(handle_type h) {
+				STL2_EXPECT(contains(h));
+				free_.push_back(h);
+				const auto i = pos_[h];
+				pos_[h] = npos;
+				const auto last = heap_.back();
+				heap_.pop_back();
+				if (i != heap_.size()) {
+					heap_[i] = last;
+					pos_[last] = i;
+					restore(i);
+				}
+			}
+
+		private:
+			static constexpr size_type npos =
+				std::numeric_limits<size_type>::max();
+
+			struct handle_proj {
+				const indexed_heap* self_;
+
+				decltype(auto) operator()(handle_type h) const {
+					return __stl2::invoke(self_->proj_, self_->values_[h]);
+				}
+			};
+
+			std::vector<handle_type> heap_;
+			std::vector<T> values_;
+			std::vector<size_type> pos_;
+			std::vector<handle_type> free_;
+			Comp comp_;
+			Proj proj_;
+
+			void sift_up(size_type i) {
+				detail::__sift_up_n_fn<Arity>{}(heap_.data(),
+					static_cast<std::ptrdiff_t>(i + 1), __stl2::ref(comp_),
+					handle_proj{this});
+				// Each handle the sift moved still records the position it moved
+				// from, which is the next position along the sift path. Walk the
+				// path upward from i, updating positions, until reaching the
+				// handle that started at i.
+				for (;;) {
+					const auto from = std::exchange(pos_[heap_[i]], i);
+					if (from >= i) break;
+					i = from;
+				}
+			}
+
+			void sift_down(size_type i) {
+				detail::__sift_down_n_fn<Arity>{}(heap_.data(),
+					static_cast<std::ptrdiff_t>(size()), heap_.data() + i,
+					__stl2::ref(comp_), handle_proj{this});
+				// As in sift_up, but the path leads downward from i.
+				for (;;) {
+					const auto from = std::exchange(pos_[heap_[i]], i);
+					if (from <= i) break;
+					i = from;
+				}
+			}
+
+			// Move the element at offset i up or down to its proper place.
+			void restore(size_type i) {
+				if (i > 0 && __stl2::invoke(comp_,
+					__stl2::invoke(proj_, values_[heap_[(i - 1) / Arity]]),
+					__stl2::invoke(proj_, values_[heap_[i]])))
+				{
+					sift_up(i);
+				} else {
+					sift_down(i);
+				}
+			}
+		};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
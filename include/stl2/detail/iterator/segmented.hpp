@@ -0,0 +1,127 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ITERATOR_SEGMENTED_HPP
+#define STL2_DETAIL_ITERATOR_SEGMENTED_HPP
+
+#include <type_traits>
+#include <utility>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Segmented iterators [Extension]
+// After Austern, "Segmented Iterators and Hierarchical Algorithms". A
+// segmented iterator denotes a position in a sequence of segments - e.g.,
+// the inner ranges of a join_view - as a pair of a segment iterator and a
+// local iterator into that segment. Algorithms that recognize one can run
+// a tight loop over each segment in turn, rather than paying the
+// segment-crossing checks of the flat iterator at every step.
+//
+// An iterator type opts in by naming a class type segmented_traits, with:
+// * segment_iterator and local_iterator types,
+// * sentinel: the sentinel type that denotes the end of all segments,
+// * segment(i) and local(i), which decompose the iterator i,
+// * begin(s) and end(s), the local range of the segment s,
+// * segments_end(i), the end of the sequence of segments of i, and
+// * compose(i, s, l), an iterator of the same sequence as i denoting the
+//   position l in the segment s. compose(i, segments_end(i), {}) is the
+//   end of the sequence.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I>
+		struct segmented_iterator_traits {};
+
+		template<class I>
+		requires std::is_class_v<typename I::segmented_traits>
+		struct segmented_iterator_traits<I> : I::segmented_traits {};
+
+		template<class I>
+		META_CONCEPT SegmentedIterator = ForwardIterator<I> &&
+			requires(const I& i) {
+				typename segmented_iterator_traits<I>::segment_iterator;
+				typename segmented_iterator_traits<I>::local_iterator;
+				typename segmented_iterator_traits<I>::sentinel;
+				segmented_iterator_traits<I>::segment(i);
+				segmented_iterator_traits<I>::local(i);
+				segmented_iterator_traits<I>::segments_end(i);
+			} &&
+			ForwardIterator<typename segmented_iterator_traits<I>::local_iterator>;
+
+		// Can [I, S) be traversed segment by segment?
+		template<class S, class I>
+		META_CONCEPT SegmentedSentinel = SegmentedIterator<I> && Sentinel<S, I> &&
+			(Same<S, I> || Same<S, typename segmented_iterator_traits<I>::sentinel>);
+	}
+
+	namespace detail {
+		// Call f(lfirst, llast) for each local range in [first, last), in
+		// order. f returns either void, or the local position at which it
+		// stopped; the walk ends early at any position other than llast,
+		// and returns the corresponding iterator. Otherwise the walk
+		// returns the end of [first, last).
+		template<class I, class S, class F>
+		requires ext::SegmentedSentinel<S, I>
+		constexpr I segmented_walk(I first, const S& last, F f) {
+			using T = ext::segmented_iterator_traits<I>;
+			using L = typename T::local_iterator;
+			auto seg = T::segment(first);
+			const auto send = T::segments_end(first);
+
+			// Visit the local range [lfirst, llast) of seg. If f stops early,
+			// point first at the stop and return true.
+			auto visit = [&](L lfirst, const auto& llast) {
+				if constexpr (std::is_void_v<decltype(f(std::move(lfirst), llast))>) {
+					f(std::move(lfirst), llast);
+					return false;
+				} else {
+					L pos = f(std::move(lfirst), llast);
+					if (pos == llast) return false;
+					first = T::compose(first, seg, std::move(pos));
+					return true;
+				}
+			};
+
+			if constexpr (Same<S, I>) {
+				const auto lseg = T::segment(last);
+				if (seg == lseg) {
+					if (seg != send && visit(T::local(first), T::local(last))) {
+						return first;
+					}
+					return last;
+				}
+			} else {
+				if (seg == send) return first;
+			}
+
+			for (auto pos = T::local(first);; pos = T::begin(seg)) {
+				if (visit(std::move(pos), T::end(seg))) return first;
+				++seg;
+				if constexpr (Same<S, I>) {
+					if (seg == T::segment(last)) {
+						if (seg != send && visit(T::begin(seg), T::local(last))) {
+							return first;
+						}
+						return last;
+					}
+				} else {
+					if (seg == send) return T::compose(first, seg, L{});
+				}
+			}
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
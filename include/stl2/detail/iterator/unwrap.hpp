@@ -0,0 +1,198 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_ITERATOR_UNWRAP_HPP
+#define STL2_DETAIL_ITERATOR_UNWRAP_HPP
+
+#include <memory>
+#include <type_traits>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/counted_iterator.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/iterator/reverse_iterator.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// unwrap and rewrap [Extension]
+// ext::unwrap(first, last) strips adaptor layers from the iterator and
+// sentinel of a range, producing an equivalent range of simpler type:
+// * a counted_iterator over a contiguous iterator, with a default_sentinel
+//   or another counted_iterator, becomes a range of the underlying
+//   iterator - only contiguous, since the positions of some random-access
+//   iterators, such as repeat_view's, are indistinguishable,
+// * a contiguous iterator becomes a pointer,
+// * reverse_iterator<reverse_iterator<I>> becomes I, and a range of
+//   reverse_iterator<I> becomes a range of reverse_iterator<J> if I
+//   unwraps to J,
+// and so on recursively. Unwrapping never changes the reference type, so
+// algorithms may apply it at entry without changing the meaning of their
+// function objects. Anything else - including move_iterator, whose
+// reference type would change, and common_iterator, whose end might hold
+// either an iterator or a sentinel - is left as is.
+//
+// ext::rewrap(first, ufirst, upos) maps a position upos in the unwrapped
+// range back to an iterator of the original type. The unwrappings above
+// are all of random-access iterators, so this is first advanced by
+// upos - ufirst.
+//
+// Other adaptors opt in by declaring, where ADL finds them, an
+// unwrap(first, last) that returns a range of the same reference type as
+// an object with members first and last, which is then unwrapped further,
+// and - unless they are random-access - a matching rewrap(first, ufirst,
+// upos) that returns an I, and may itself call ext::rewrap on the base.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<class I, class S = I>
+		struct unwrap_result {
+			I first;
+			S last;
+		};
+	}
+
+	namespace __unwrapping {
+		// Not poison pills, simply non-ADL blocks.
+		void unwrap(); // undefined
+		void rewrap(); // undefined
+
+		template<class I, class S>
+		using custom_result_t =
+			decltype(unwrap(std::declval<I>(), std::declval<S>()));
+
+		template<class I, class S>
+		constexpr bool has_customization = false;
+		template<class I, class S>
+		requires
+			requires(I&& i, S&& s) {
+				unwrap(static_cast<I&&>(i), static_cast<S&&>(s)).first;
+				unwrap(static_cast<I&&>(i), static_cast<S&&>(s)).last;
+			} &&
+			Iterator<decltype(std::declval<custom_result_t<I, S>>().first)> &&
+			Sentinel<decltype(std::declval<custom_result_t<I, S>>().last),
+				decltype(std::declval<custom_result_t<I, S>>().first)> &&
+			Same<iter_reference_t<decltype(std::declval<custom_result_t<I, S>>().first)>,
+				iter_reference_t<I>>
+		constexpr bool has_customization<I, S> = true;
+
+		template<class> constexpr bool is_counted = false;
+		template<class I> constexpr bool is_counted<counted_iterator<I>> =
+			ContiguousIterator<I>;
+
+		template<class> constexpr bool is_reverse = false;
+		template<class I> constexpr bool is_reverse<reverse_iterator<I>> = true;
+
+		struct fn {
+			template<Iterator I, Sentinel<I> S>
+			constexpr auto operator()(I first, S last) const {
+				if constexpr (has_customization<I, S>) {
+					auto [ufirst, ulast] = unwrap(std::move(first), std::move(last));
+					using UI = decltype(ufirst);
+					using US = decltype(ulast);
+					if constexpr (Same<UI, I> && Same<US, S>) {
+						return ext::unwrap_result<I, S>{std::move(ufirst), std::move(ulast)};
+					} else {
+						return (*this)(std::move(ufirst), std::move(ulast));
+					}
+				} else if constexpr (is_counted<I> &&
+					(Same<S, default_sentinel> || Same<S, I>))
+				{
+					auto base = first.base();
+					if constexpr (Same<S, I>) {
+						return (*this)(std::move(base), last.base());
+					} else {
+						auto end = base + first.count();
+						return (*this)(std::move(base), std::move(end));
+					}
+				} else if constexpr (ContiguousIterator<I> && !std::is_pointer_v<I> &&
+					SizedSentinel<S, I>)
+				{
+					using P = std::add_pointer_t<iter_reference_t<I>>;
+					const auto n = last - first;
+					P p = n ? std::addressof(*first) : nullptr;
+					return ext::unwrap_result<P>{p, p + n};
+				} else if constexpr (is_reverse<I> && Same<S, I>) {
+					using J = decltype(first.base());
+					if constexpr (is_reverse<J>) {
+						return (*this)(first.base().base(), last.base().base());
+					} else {
+						auto [ufirst, ulast] = (*this)(last.base(), first.base());
+						using UJ = decltype(ufirst);
+						if constexpr (Same<UJ, decltype(ulast)> && !Same<UJ, J>) {
+							return ext::unwrap_result<reverse_iterator<UJ>>{
+								reverse_iterator<UJ>{std::move(ulast)},
+								reverse_iterator<UJ>{std::move(ufirst)}};
+						} else {
+							return ext::unwrap_result<I, S>{std::move(first), std::move(last)};
+						}
+					}
+				} else {
+					return ext::unwrap_result<I, S>{std::move(first), std::move(last)};
+				}
+			}
+		};
+
+		template<class I, class UI>
+		constexpr bool has_rewrap = false;
+		template<class I, class UI>
+		requires
+			requires(I&& i, const UI& ufirst, UI&& upos) {
+				rewrap(static_cast<I&&>(i), ufirst, static_cast<UI&&>(upos));
+			} &&
+			Same<decltype(rewrap(std::declval<I>(), std::declval<const UI&>(),
+				std::declval<UI>())), I>
+		constexpr bool has_rewrap<I, UI> = true;
+
+		template<class I, class UI>
+		META_CONCEPT rewrappable = Same<I, UI> || has_rewrap<I, UI> ||
+			(RandomAccessIterator<I> && SizedSentinel<UI, UI>);
+
+		struct rewrap_fn {
+			template<Iterator I, class UI>
+			requires rewrappable<I, UI>
+			constexpr I operator()(I first, const UI& ufirst, UI upos) const {
+				if constexpr (Same<I, UI>) {
+					(void)first;
+					(void)ufirst;
+					return upos;
+				} else if constexpr (has_rewrap<I, UI>) {
+					return rewrap(std::move(first), ufirst, std::move(upos));
+				} else {
+					first += static_cast<iter_difference_t<I>>(upos - ufirst);
+					return first;
+				}
+			}
+		};
+	}
+
+	namespace ext {
+		inline constexpr __unwrapping::fn unwrap {};
+
+		template<class I, class S>
+		using unwrapped_iterator_t =
+			decltype(unwrap(std::declval<I>(), std::declval<S>()).first);
+		template<class I, class S>
+		using unwrapped_sentinel_t =
+			decltype(unwrap(std::declval<I>(), std::declval<S>()).last);
+
+		inline constexpr __unwrapping::rewrap_fn rewrap {};
+
+		// Does unwrap simplify the range [I, S), in a way rewrap can undo?
+		template<class I, class S>
+		META_CONCEPT Unwrappable = Iterator<I> && Sentinel<S, I> &&
+			!(Same<unwrapped_iterator_t<I, S>, I> &&
+			  Same<unwrapped_sentinel_t<I, S>, S>) &&
+			__unwrapping::rewrappable<I, unwrapped_iterator_t<I, S>>;
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
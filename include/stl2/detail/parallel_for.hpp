@@ -0,0 +1,46 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_PARALLEL_FOR_HPP
+#define STL2_DETAIL_PARALLEL_FOR_HPP
+
+#include <functional>
+#include <future>
+#include <system_error>
+#include <vector>
+#include <stl2/detail/fwd.hpp>
+
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		// Run f(0), ..., f(workers - 1) concurrently, f(0) on the calling
+		// thread; a worker whose thread cannot be started - as when the
+		// program is not linked with the threads library - runs inline
+		// instead. Returns the number of threads started.
+		template<class F>
+		unsigned __parallel_for(unsigned workers, F f)
+		{
+			std::vector<std::future<void>> pending;
+			pending.reserve(workers > 0 ? workers - 1 : 0);
+			for (unsigned w = 1; w < workers; ++w) {
+				try {
+					pending.push_back(std::async(std::launch::async, std::ref(f), w));
+				} catch (const std::system_error&) {
+					f(w);
+				}
+			}
+			if (workers > 0) f(0);
+			for (auto& p : pending) p.get();
+			return static_cast<unsigned>(pending.size());
+		}
+	}
+} STL2_CLOSE_NAMESPACE
+
+#endif
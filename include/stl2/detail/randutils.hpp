@@ -15,11 +15,13 @@
 
 #include <cstdint>
 #include <initializer_list>
+#include <limits>
 #include <random>
 #include <stl2/random.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/meta.hpp>
 #include <stl2/detail/algorithm/generate.hpp>
+#include <stl2/detail/concepts/urng.hpp>
 
 STL2_OPEN_NAMESPACE {
 	namespace detail {
@@ -57,6 +59,95 @@ STL2_OPEN_NAMESPACE {
 			}();
 			return engine;
 		}
+
+		// The high and low words of the 128-bit product of a and b.
+		constexpr std::uint64_t __mul_wide(std::uint64_t a, std::uint64_t b,
+			std::uint64_t& lo) noexcept
+		{
+#ifdef __SIZEOF_INT128__
+			__extension__ using u128 = unsigned __int128;
+			const u128 m = static_cast<u128>(a) * b;
+			lo = static_cast<std::uint64_t>(m);
+			return static_cast<std::uint64_t>(m >> 64);
+#else
+			const std::uint64_t a0 = a & 0xffffffff, a1 = a >> 32;
+			const std::uint64_t b0 = b & 0xffffffff, b1 = b >> 32;
+			const std::uint64_t p00 = a0 * b0, p01 = a0 * b1;
+			const std::uint64_t p10 = a1 * b0, p11 = a1 * b1;
+			const std::uint64_t mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+			lo = (mid << 32) | (p00 & 0xffffffff);
+			return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+		}
+
+		// Lemire's nearly divisionless bounded random: the high word of a
+		// random word times s is in [0, s), and biased only when the low word
+		// falls below 2^w mod s; that remainder - the one division - is
+		// computed only when the low word is small enough to be in danger.
+		template<class U, class G>
+		constexpr U __lemire(G& g, U s)
+		{
+			constexpr bool wide = sizeof(U) == 8;
+			std::uint64_t lo = 0;
+			auto draw = [&] {
+				const U x = static_cast<U>(g());
+				if constexpr (wide) {
+					return __mul_wide(x, s, lo);
+				} else {
+					const std::uint64_t m = std::uint64_t{x} * s;
+					lo = static_cast<std::uint32_t>(m);
+					return m >> 32;
+				}
+			};
+			auto r = draw();
+			if (lo < s) {
+				const U t = static_cast<U>(-s) % s;
+				while (lo < t) r = draw();
+			}
+			return static_cast<U>(r);
+		}
+
+		// The width of the words g produces: 32 or 64 for generators whose
+		// results are all the values of such a word, 0 otherwise.
+		template<class G>
+		inline constexpr int __word_bits =
+			G::min() != 0 ? 0 :
+			G::max() == ~std::uint64_t{0} ? 64 :
+			G::max() == ~std::uint32_t{0} ? 32 : 0;
+
+		// A uniformly distributed integer in [0, bound), for bound > 0,
+		// without the per-call set-up of uniform_int_distribution when g
+		// produces whole 32- or 64-bit words.
+		template<Integral D, UniformRandomBitGenerator G>
+		constexpr D __bounded_random(G& g, D bound)
+		{
+			STL2_EXPECT(bound > 0);
+			using U = std::make_unsigned_t<D>;
+			if constexpr (__word_bits<G> == 64) {
+				return static_cast<D>(__lemire(g, std::uint64_t{static_cast<U>(bound)}));
+			} else if constexpr (__word_bits<G> == 32) {
+				if constexpr (sizeof(U) <= 4) {
+					return static_cast<D>(__lemire(g, std::uint32_t{static_cast<U>(bound)}));
+				} else if (static_cast<U>(bound) <= ~std::uint32_t{0}) {
+					return static_cast<D>(__lemire(g, static_cast<std::uint32_t>(bound)));
+				}
+			}
+			using dist_t = std::uniform_int_distribution<
+				meta::if_c<(sizeof(D) < sizeof(short)), int, D>>;
+			return static_cast<D>(dist_t{0, bound - 1}(g));
+		}
+
+		// A uniformly distributed double in (0, 1], safe to take the log of.
+		template<UniformRandomBitGenerator G>
+		double __random_unit(G& g)
+		{
+			if constexpr (__word_bits<G> == 64) {
+				return static_cast<double>((g() >> 11) + 1) * 0x1p-53;
+			} else {
+				return 1.0 - std::generate_canonical<double,
+					std::numeric_limits<double>::digits>(g);
+			}
+		}
 	}
 } STL2_CLOSE_NAMESPACE
 
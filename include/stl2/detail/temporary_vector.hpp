@@ -110,7 +110,7 @@ STL2_OPEN_NAMESPACE {
 			temporary_vector() = default;
 			temporary_vector(temporary_buffer<T>& buf)
 			: begin_{buf.data()}, end_{begin_}
-			, alloc_{begin_ + buf.size_}
+			, alloc_{begin_ + buf.size()}
 			{}
 			temporary_vector(temporary_vector&&) = delete;
 			temporary_vector& operator=(temporary_vector&& that) = delete;
@@ -0,0 +1,136 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_DETAIL_XOSHIRO_HPP
+#define STL2_DETAIL_XOSHIRO_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/concepts/core.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// xoshiro256pp [Extension]
+// Blackman and Vigna's xoshiro256++: a 64-bit generator with 256 bits of
+// state, period 2^256 - 1, that passes the usual statistical batteries
+// and costs a handful of shifts, xors and adds per number - several times
+// cheaper than mt19937_64, with a 32-byte state instead of 2.5KB. It is
+// not cryptographically secure.
+//
+// A seed value is expanded into the state by splitmix64, as its authors
+// recommend; jump() advances the generator by 2^128 numbers, splitting
+// one seed into non-overlapping streams for independent workers.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		class xoshiro256pp {
+		public:
+			using result_type = std::uint64_t;
+			static constexpr result_type default_seed = 0x9e3779b97f4a7c15;
+
+			constexpr xoshiro256pp() noexcept
+			: xoshiro256pp(default_seed) {}
+
+			constexpr explicit xoshiro256pp(result_type value) noexcept
+			{ seed(value); }
+
+			template<class Sseq>
+			requires !ConvertibleTo<Sseq&, result_type> &&
+				!Same<std::remove_cv_t<Sseq>, xoshiro256pp>
+			explicit xoshiro256pp(Sseq& seq)
+			{ seed(seq); }
+
+			constexpr void seed(result_type value = default_seed) noexcept
+			{
+				for (auto& s : s_) {
+					s = splitmix64(value);
+				}
+			}
+
+			template<class Sseq>
+			requires !ConvertibleTo<Sseq&, result_type>
+			void seed(Sseq& seq)
+			{
+				std::uint32_t words[8]{};
+				seq.generate(words, words + 8);
+				for (int i = 0; i < 4; ++i) {
+					s_[i] = std::uint64_t{words[2 * i]} << 32 | words[2 * i + 1];
+				}
+				// The all-zero state is a fixed point.
+				if (!(s_[0] | s_[1] | s_[2] | s_[3])) seed();
+			}
+
+			static constexpr result_type min() noexcept { return 0; }
+			static constexpr result_type max() noexcept { return ~result_type{0}; }
+
+			constexpr result_type operator()() noexcept
+			{
+				const result_type result = rotl(s_[0] + s_[3], 23) + s_[0];
+				const result_type t = s_[1] << 17;
+				s_[2] ^= s_[0];
+				s_[3] ^= s_[1];
+				s_[1] ^= s_[2];
+				s_[0] ^= s_[3];
+				s_[2] ^= t;
+				s_[3] = rotl(s_[3], 45);
+				return result;
+			}
+
+			constexpr void discard(unsigned long long n) noexcept
+			{
+				for (; n != 0; --n) (*this)();
+			}
+
+			// Advance by 2^128 numbers.
+			constexpr void jump() noexcept
+			{
+				constexpr result_type poly[] = {
+					0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+					0xa9582618e03fc9aa, 0x39abdc4529b1661c
+				};
+				result_type s[4]{};
+				for (auto word : poly) {
+					for (int b = 0; b < 64; ++b) {
+						if (word >> b & 1) {
+							for (int i = 0; i < 4; ++i) s[i] ^= s_[i];
+						}
+						(*this)();
+					}
+				}
+				for (int i = 0; i < 4; ++i) s_[i] = s[i];
+			}
+
+			friend constexpr bool operator==(const xoshiro256pp& x, const xoshiro256pp& y) noexcept
+			{
+				return x.s_[0] == y.s_[0] && x.s_[1] == y.s_[1] &&
+					x.s_[2] == y.s_[2] && x.s_[3] == y.s_[3];
+			}
+			friend constexpr bool operator!=(const xoshiro256pp& x, const xoshiro256pp& y) noexcept
+			{ return !(x == y); }
+
+		private:
+			result_type s_[4]{};
+
+			static constexpr result_type rotl(result_type x, int k) noexcept
+			{ return x << k | x >> (64 - k); }
+
+			static constexpr result_type splitmix64(result_type& x) noexcept
+			{
+				result_type z = x += 0x9e3779b97f4a7c15;
+				z = (z ^ z >> 30) * 0xbf58476d1ce4e5b9;
+				z = (z ^ z >> 27) * 0x94d049bb133111eb;
+				return z ^ z >> 31;
+			}
+		};
+	} // namespace ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -19,6 +19,8 @@
 #include <stl2/detail/meta.hpp>
 #include <stl2/detail/concepts/compare.hpp>
 #include <stl2/detail/concepts/core.hpp>
+#include <stl2/detail/functional/char_set.hpp>
+#include <stl2/detail/functional/compare_to.hpp>
 #include <stl2/detail/functional/comparisons.hpp>
 #include <stl2/detail/functional/invoke.hpp>
 #include <stl2/detail/functional/not_fn.hpp>
@@ -46,6 +48,12 @@ STL2_OPEN_NAMESPACE {
 
 		using is_transparent = std::true_type;
 	};
+
+	// Is F - or the referent of F, if F is a reference_wrapper - the
+	// function object type T? Algorithms use this to select fast paths for
+	// the default comparisons and projection.
+	template<class F, class T>
+	META_CONCEPT __same_function_object = Same<__uncvref<__unwrap<F>>, T>;
 } STL2_CLOSE_NAMESPACE
 
 #endif
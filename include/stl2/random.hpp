@@ -14,6 +14,7 @@
 
 #include <random>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/xoshiro.hpp>
 #include <stl2/detail/concepts/urng.hpp>
 
 #endif
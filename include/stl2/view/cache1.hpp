@@ -0,0 +1,165 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_CACHE1_HPP
+#define STL2_VIEW_CACHE1_HPP
+
+#include <type_traits>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/non_propagating_cache.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// cache1_view [Extension]
+// An input view of the values of the underlying view that holds on to the
+// value of the current element, computing it at most once however many
+// times it is dereferenced. Pipelines such as
+//   rng | view::transform(decode) | view::filter(pred)
+// otherwise evaluate decode once in filter's search and again when the
+// result is read; inserting cache1 after the transform evaluates it once.
+// The cache lives in the view, so the view is an input range whose
+// elements are lvalues of the value type.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<InputRange V>
+		requires View<V> && MoveConstructible<iter_value_t<iterator_t<V>>> &&
+			Constructible<iter_value_t<iterator_t<V>>, iter_reference_t<iterator_t<V>>>
+		class cache1_view : public view_interface<cache1_view<V>> {
+		private:
+			class __iterator;
+			class __sentinel;
+
+			using value_type = iter_value_t<iterator_t<V>>;
+
+			V base_ = V();
+			detail::non_propagating_cache<iterator_t<V>> current_;
+			detail::non_propagating_cache<value_type> cache_;
+
+		public:
+			cache1_view() = default;
+
+			constexpr explicit cache1_view(V base)
+			: base_(std::move(base)) {}
+
+			constexpr V base() const { return base_; }
+
+			constexpr __iterator begin()
+			{
+				cache_.reset();
+				current_ = __stl2::begin(base_);
+				return __iterator{*this};
+			}
+
+			constexpr __sentinel end()
+			{ return __sentinel{__stl2::end(base_)}; }
+
+			constexpr auto size() requires SizedRange<V>
+			{ return __stl2::size(base_); }
+
+			constexpr auto size() const requires SizedRange<const V>
+			{ return __stl2::size(base_); }
+		};
+
+		template<class R>
+		cache1_view(R&&) -> cache1_view<all_view<R>>;
+
+		template<InputRange V>
+		requires View<V> && MoveConstructible<iter_value_t<iterator_t<V>>> &&
+			Constructible<iter_value_t<iterator_t<V>>, iter_reference_t<iterator_t<V>>>
+		class cache1_view<V>::__iterator {
+		private:
+			cache1_view* parent_ = nullptr;
+			friend __sentinel;
+		public:
+			using iterator_category = __stl2::input_iterator_tag;
+			using value_type = iter_value_t<iterator_t<V>>;
+			using difference_type = iter_difference_t<iterator_t<V>>;
+
+			__iterator() = default;
+
+			constexpr explicit __iterator(cache1_view& parent)
+			: parent_(&parent) {}
+
+			constexpr iterator_t<V> base() const
+			{ return *parent_->current_; }
+
+			constexpr value_type& operator*() const
+			{
+				auto& cache = parent_->cache_;
+				if (!cache) {
+					cache.emplace(**parent_->current_);
+				}
+				return *cache;
+			}
+
+			constexpr __iterator& operator++()
+			{
+				++*parent_->current_;
+				parent_->cache_.reset();
+				return *this;
+			}
+
+			constexpr void operator++(int)
+			{ ++*this; }
+
+			friend constexpr value_type&& iter_move(const __iterator& i)
+			{ return std::move(*i); }
+		};
+
+		template<InputRange V>
+		requires View<V> && MoveConstructible<iter_value_t<iterator_t<V>>> &&
+			Constructible<iter_value_t<iterator_t<V>>, iter_reference_t<iterator_t<V>>>
+		class cache1_view<V>::__sentinel {
+		private:
+			sentinel_t<V> end_ {};
+
+			constexpr bool equal(const __iterator& i) const
+			{ return *i.parent_->current_ == end_; }
+		public:
+			__sentinel() = default;
+			constexpr explicit __sentinel(sentinel_t<V> end)
+			: end_(std::move(end)) {}
+
+			constexpr sentinel_t<V> base() const
+			{ return end_; }
+
+			friend constexpr bool operator==(const __iterator& x, const __sentinel& y)
+			{ return y.equal(x); }
+			friend constexpr bool operator==(const __sentinel& x, const __iterator& y)
+			{ return x.equal(y); }
+			friend constexpr bool operator!=(const __iterator& x, const __sentinel& y)
+			{ return !y.equal(x); }
+			friend constexpr bool operator!=(const __sentinel& x, const __iterator& y)
+			{ return !x.equal(y); }
+		};
+	} // namespace ext
+
+	namespace view::ext {
+		struct __cache1_fn : detail::__pipeable<__cache1_fn> {
+			template<InputRange R>
+			requires ViewableRange<R>
+			constexpr auto operator()(R&& rng) const
+			STL2_REQUIRES_RETURN(
+				__stl2::ext::cache1_view{view::all(std::forward<R>(rng))}
+			)
+		};
+
+		inline constexpr __cache1_fn cache1 {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,124 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_CACHE_ALL_HPP
+#define STL2_VIEW_CACHE_ALL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/swap.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// cache_all_view [Extension]
+// The values of the underlying view, materialized into a buffer the first
+// time the view is iterated. Every later pass - and every dereference -
+// reads the buffer, so an expensive pipeline upstream is evaluated exactly
+// once per element however often the elements are read, and an input view
+// becomes a contiguous one. Copies of the view share the buffer, whether
+// they are taken before or after it is filled, so none of them reads the
+// underlying view a second time. A view that is moved from starts over.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<InputRange V>
+		requires View<V> && Movable<iter_value_t<iterator_t<V>>> &&
+			Constructible<iter_value_t<iterator_t<V>>, iter_reference_t<iterator_t<V>>>
+		class cache_all_view : public view_interface<cache_all_view<V>> {
+		private:
+			using value_type = iter_value_t<iterator_t<V>>;
+			using buffer_t = std::vector<value_type>;
+
+			struct __cache {
+				buffer_t values;
+				bool filled = false;
+			};
+
+			V base_ = V();
+			std::shared_ptr<__cache> cache_ = std::make_shared<__cache>();
+
+			buffer_t& buffer() {
+				auto& cache = *cache_;
+				if (!cache.filled) {
+					auto& buf = cache.values;
+					buf.clear();
+					if constexpr (SizedRange<V>) {
+						buf.reserve(static_cast<std::size_t>(__stl2::size(base_)));
+					}
+					auto last = __stl2::end(base_);
+					for (auto first = __stl2::begin(base_); first != last; ++first) {
+						buf.emplace_back(*first);
+					}
+					cache.filled = true;
+				}
+				return cache.values;
+			}
+
+		public:
+			cache_all_view() = default;
+			cache_all_view(const cache_all_view&) = default;
+			// A moved-from view starts over with a buffer of its own.
+			cache_all_view(cache_all_view&& that)
+			: base_(std::move(that.base_))
+			, cache_(__stl2::exchange(that.cache_, std::make_shared<__cache>()))
+			{}
+			cache_all_view& operator=(const cache_all_view&) = default;
+			cache_all_view& operator=(cache_all_view&& that)
+			{
+				base_ = std::move(that.base_);
+				cache_ = __stl2::exchange(that.cache_, std::make_shared<__cache>());
+				return *this;
+			}
+
+			constexpr explicit cache_all_view(V base)
+			: base_(std::move(base)) {}
+
+			constexpr V base() const { return base_; }
+
+			iterator_t<buffer_t> begin()
+			{ return buffer().begin(); }
+
+			iterator_t<buffer_t> end()
+			{ return buffer().end(); }
+
+			value_type* data()
+			{ return buffer().data(); }
+
+			std::size_t size()
+			{ return buffer().size(); }
+		};
+
+		template<class R>
+		cache_all_view(R&&) -> cache_all_view<all_view<R>>;
+	} // namespace ext
+
+	namespace view::ext {
+		struct __cache_all_fn : detail::__pipeable<__cache_all_fn> {
+			template<InputRange R>
+			requires ViewableRange<R>
+			constexpr auto operator()(R&& rng) const
+			STL2_REQUIRES_RETURN(
+				__stl2::ext::cache_all_view{view::all(std::forward<R>(rng))}
+			)
+		};
+
+		inline constexpr __cache_all_fn cache_all {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
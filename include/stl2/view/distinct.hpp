@@ -0,0 +1,250 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_DISTINCT_HPP
+#define STL2_VIEW_DISTINCT_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/hash_index.hpp>
+#include <stl2/detail/non_propagating_cache.hpp>
+#include <stl2/detail/semiregular_box.hpp>
+#include <stl2/detail/functional/invoke.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// distinct_view [Extension]
+// The elements of the underlying view whose keys - their projections -
+// differ from those of all earlier elements, i.e., the first occurrence
+// of each key, in order. The view indexes the first occurrences it has
+// passed in a hash table; since whether an element is a first occurrence
+// does not depend on how it was reached, iterators may be copied and
+// traversed independently, in either direction. Traversing the whole view
+// takes expected O(N) time and the table holds O(N) iterators.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<View V, class Proj = identity>
+		requires ForwardRange<V> && CopyConstructible<Proj> &&
+			detail::HashIndexable<iterator_t<V>, Proj>
+		class distinct_view : public view_interface<distinct_view<V, Proj>> {
+		private:
+			class __iterator;
+			class __sentinel;
+
+			struct __index {
+				detail::hash_index<iterator_t<V>> table;
+				// Has a pass indexed every element?
+				bool complete = false;
+			};
+
+			V base_;
+			detail::semiregular_box<Proj> proj_;
+			detail::non_propagating_cache<__index> index_;
+
+			void make_index() {
+				if (!index_) {
+					index_.emplace();
+					if constexpr (SizedRange<V>) {
+						index_->table.reserve(static_cast<std::size_t>(__stl2::size(base_)));
+					}
+				}
+			}
+
+			// Index every element, unless some pass already has.
+			void index_all() {
+				make_index();
+				if (index_->complete) return;
+				const auto last = __stl2::end(base_);
+				for (auto i = __stl2::begin(base_); i != last; ++i) {
+					(void)is_first(i);
+				}
+				index_->complete = true;
+			}
+
+			// Is the element at i the first with its key? Indexes i if so.
+			bool is_first(const iterator_t<V>& i) {
+				auto& proj = proj_.get();
+				auto&& key = __stl2::invoke(proj, *i);
+				auto [s, inserted] = index_->table.insert(detail::hash_index_key(key), i,
+					[&](const iterator_t<V>& j) {
+						return __stl2::invoke(equal_to{}, key,
+							__stl2::invoke(proj, *j));
+					});
+				return inserted || s->pos == i;
+			}
+
+		public:
+			distinct_view() = default;
+
+			constexpr explicit distinct_view(V base, Proj proj = {})
+			: base_(std::move(base)), proj_(std::move(proj)) {}
+
+			constexpr V base() const
+			{ return base_; }
+
+			__iterator begin()
+			{
+				make_index();
+				// The first element is always distinct.
+				auto first = __stl2::begin(base_);
+				if (first != __stl2::end(base_)) {
+					(void)is_first(first);
+				}
+				return __iterator{*this, std::move(first)};
+			}
+
+			__sentinel end()
+			{ return __sentinel{*this}; }
+
+			__iterator end() requires CommonRange<V>
+			{ return __iterator{*this, __stl2::end(base_)}; }
+		};
+
+		template<View V, class Proj>
+		requires ForwardRange<V> && CopyConstructible<Proj> &&
+			detail::HashIndexable<iterator_t<V>, Proj>
+		class distinct_view<V, Proj>::__iterator {
+		private:
+			iterator_t<V> current_ {};
+			distinct_view* parent_ = nullptr;
+			friend __sentinel;
+		public:
+			using iterator_category =
+				meta::if_c<BidirectionalIterator<iterator_t<V>>,
+					__stl2::bidirectional_iterator_tag,
+					__stl2::forward_iterator_tag>;
+			using value_type = iter_value_t<iterator_t<V>>;
+			using difference_type = iter_difference_t<iterator_t<V>>;
+
+			__iterator() = default;
+
+			constexpr __iterator(distinct_view& parent, iterator_t<V> current)
+			: current_(std::move(current)), parent_(&parent) {}
+
+			constexpr iterator_t<V> base() const
+			{ return current_; }
+
+			constexpr iter_reference_t<iterator_t<V>> operator*() const
+			{ return *current_; }
+
+			__iterator& operator++()
+			{
+				const auto last = __stl2::end(parent_->base_);
+				STL2_ASSERT(current_ != last);
+				while (++current_ != last && !parent_->is_first(current_))
+					;
+				if (current_ == last) parent_->index_->complete = true;
+				return *this;
+			}
+
+			__iterator operator++(int)
+			{
+				auto tmp = *this;
+				++*this;
+				return tmp;
+			}
+
+			// A position reached by ++ has every element before it indexed,
+			// so stepping back from it only looks up positions. end() may
+			// not have been reached so; stepping back from it first indexes
+			// the whole range.
+			__iterator& operator--() requires BidirectionalRange<V>
+			{
+				if (current_ == __stl2::end(parent_->base_)) {
+					parent_->index_all();
+				}
+				do
+					--current_;
+				while (!parent_->is_first(current_));
+				return *this;
+			}
+
+			__iterator operator--(int) requires BidirectionalRange<V>
+			{
+				auto tmp = *this;
+				--*this;
+				return tmp;
+			}
+
+			friend constexpr bool operator==(const __iterator& x, const __iterator& y)
+			{ return x.current_ == y.current_; }
+
+			friend constexpr bool operator!=(const __iterator& x, const __iterator& y)
+			{ return !(x == y); }
+
+			friend constexpr iter_rvalue_reference_t<iterator_t<V>>
+			iter_move(const __iterator& i)
+			noexcept(noexcept(__stl2::iter_move(i.current_)))
+			{ return __stl2::iter_move(i.current_); }
+		};
+
+		template<View V, class Proj>
+		requires ForwardRange<V> && CopyConstructible<Proj> &&
+			detail::HashIndexable<iterator_t<V>, Proj>
+		class distinct_view<V, Proj>::__sentinel {
+		private:
+			sentinel_t<V> end_;
+		public:
+			__sentinel() = default;
+			explicit constexpr __sentinel(distinct_view& parent)
+			: end_(__stl2::end(parent.base_)) {}
+
+			constexpr sentinel_t<V> base() const
+			{ return end_; }
+
+			friend constexpr bool operator==(const __iterator& x, const __sentinel& y)
+			{ return x.current_ == y.end_; }
+			friend constexpr bool operator==(const __sentinel& x, const __iterator& y)
+			{ return y == x; }
+			friend constexpr bool operator!=(const __iterator& x, const __sentinel& y)
+			{ return !(x == y); }
+			friend constexpr bool operator!=(const __sentinel& x, const __iterator& y)
+			{ return !(y == x); }
+		};
+
+		template<class R>
+		distinct_view(R&&) -> distinct_view<all_view<R>>;
+
+		template<class R, class Proj>
+		distinct_view(R&&, Proj) -> distinct_view<all_view<R>, Proj>;
+	} // namespace ext
+
+	namespace view::ext {
+		struct __distinct_fn : detail::__pipeable<__distinct_fn> {
+			template<ForwardRange R, class Proj = identity>
+			requires ViewableRange<R> && CopyConstructible<Proj> &&
+				detail::HashIndexable<iterator_t<R>, Proj>
+			constexpr auto operator()(R&& rng, Proj proj = {}) const
+			{
+				return __stl2::ext::distinct_view<all_view<R>, Proj>{
+					view::all(std::forward<R>(rng)), std::move(proj)};
+			}
+
+			template<class Proj>
+			requires !Range<Proj> && CopyConstructible<__uncvref<Proj>>
+			constexpr auto operator()(Proj&& proj) const
+			{
+				__uncvref<Proj> p = std::forward<Proj>(proj);
+				return detail::view_closure{*this, std::move(p)};
+			}
+		};
+
+		inline constexpr __distinct_fn distinct {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
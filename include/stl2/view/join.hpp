@@ -15,6 +15,7 @@
 #include <stl2/type_traits.hpp>
 #include <stl2/detail/fwd.hpp>
 #include <stl2/detail/concepts/object.hpp>
+#include <stl2/detail/iterator/segmented.hpp>
 #include <stl2/detail/range/access.hpp>
 #include <stl2/detail/range/concepts.hpp>
 #include <stl2/view/all.hpp>
@@ -164,6 +165,35 @@ STL2_OPEN_NAMESPACE {
 			satisfy_();
 		}
 
+		// Segments are the inner ranges; see detail/iterator/segmented.hpp.
+		struct __segmented_traits {
+			using segment_iterator = iterator_t<Base>;
+			using local_iterator = iterator_t<iter_reference_t<iterator_t<Base>>>;
+			using sentinel = __sentinel<Const>;
+
+			static constexpr segment_iterator segment(const __iterator& i)
+			{ return i.outer_; }
+			static constexpr local_iterator local(const __iterator& i)
+			{ return i.inner_; }
+			static constexpr local_iterator begin(const segment_iterator& s)
+			{ return __stl2::begin(*s); }
+			static constexpr auto end(const segment_iterator& s)
+			{ return __stl2::end(*s); }
+			static constexpr auto segments_end(const __iterator& i)
+			{ return __stl2::end(i.parent_->base_); }
+			static constexpr __iterator
+			compose(const __iterator& i, segment_iterator s, local_iterator l) {
+				__iterator result;
+				result.outer_ = std::move(s);
+				result.inner_ = std::move(l);
+				result.parent_ = i.parent_;
+				return result;
+			}
+		};
+		using segmented_traits = meta::if_c<ref_is_glvalue && ForwardRange<Base> &&
+			ForwardRange<iter_reference_t<iterator_t<Base>>>,
+			__segmented_traits, void>;
+
 		constexpr __iterator(__iterator<!Const> i) requires Const &&
 			ConvertibleTo<iterator_t<V>, iterator_t<Base>> &&
 			ConvertibleTo<
@@ -260,6 +290,9 @@ STL2_OPEN_NAMESPACE {
 
 		sentinel_t<Base> end_ = sentinel_t<Base>();
 
+		constexpr bool equal(const __iterator<Const>& i) const
+		{ return i.outer_ == end_; }
+
 	public:
 		__sentinel() = default;
 
@@ -271,7 +304,7 @@ STL2_OPEN_NAMESPACE {
 		: end_(std::move(s.end_)) {}
 
 		friend constexpr bool operator==(const __iterator<Const>& x, const __sentinel& y)
-		{ return x.outer_ == y.end_; }
+		{ return y.equal(x); }
 
 		friend constexpr bool operator==(const __sentinel& x, const __iterator<Const>& y)
 		{ return y == x; }
@@ -0,0 +1,161 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_MERGE_K_HPP
+#define STL2_VIEW_MERGE_K_HPP
+
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/non_propagating_cache.hpp>
+#include <stl2/detail/semiregular_box.hpp>
+#include <stl2/detail/algorithm/merge_k.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/iterator/default_sentinel.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// merge_k_view [Extension]
+// The lazy counterpart of merge_k: the elements of the sorted runs of the
+// underlying view, merged in order as the view is traversed. begin() plays
+// the initial tournament over the heads of the runs, and each increment
+// replays the winner's path. The tree lives in the view, so this is an
+// input view; its elements are the elements of the runs themselves.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<View V, class Comp = less, class Proj = identity>
+		requires detail::__mergeable_runs<V> &&
+			CopyConstructible<Comp> && CopyConstructible<Proj> &&
+			IndirectStrictWeakOrder<Comp,
+				projected<detail::__run_iterator_t<V>, Proj>>
+		class merge_k_view
+		: public view_interface<merge_k_view<V, Comp, Proj>> {
+		private:
+			class __iterator;
+			using Run = iter_reference_t<iterator_t<V>>;
+			using tree_t = detail::__loser_tree_for<iterator_t<Run>, sentinel_t<Run>, Proj>;
+
+			V base_ = V();
+			detail::semiregular_box<Comp> comp_;
+			detail::semiregular_box<Proj> proj_;
+			detail::non_propagating_cache<tree_t> tree_;
+
+		public:
+			merge_k_view() = default;
+
+			constexpr explicit merge_k_view(V base, Comp comp = {}, Proj proj = {})
+			: base_(std::move(base)), comp_(std::move(comp)), proj_(std::move(proj)) {}
+
+			constexpr V base() const { return base_; }
+
+			__iterator begin()
+			{
+				auto& tree = tree_.emplace();
+				for (auto&& r : base_) {
+					tree.push(__stl2::begin(r), __stl2::end(r));
+				}
+				tree.build(comp_.get(), proj_.get());
+				return __iterator{*this};
+			}
+
+			constexpr default_sentinel end() const noexcept
+			{ return {}; }
+		};
+
+		template<class R>
+		merge_k_view(R&&) -> merge_k_view<all_view<R>>;
+
+		template<class R, class Comp>
+		merge_k_view(R&&, Comp) -> merge_k_view<all_view<R>, Comp>;
+
+		template<class R, class Comp, class Proj>
+		merge_k_view(R&&, Comp, Proj) -> merge_k_view<all_view<R>, Comp, Proj>;
+
+		template<View V, class Comp, class Proj>
+		requires detail::__mergeable_runs<V> &&
+			CopyConstructible<Comp> && CopyConstructible<Proj> &&
+			IndirectStrictWeakOrder<Comp,
+				projected<detail::__run_iterator_t<V>, Proj>>
+		class merge_k_view<V, Comp, Proj>::__iterator {
+		private:
+			using I = iterator_t<Run>;
+			merge_k_view* parent_ = nullptr;
+
+			bool done() const
+			{ return parent_->tree_->empty(); }
+
+			I& current() const
+			{ return parent_->tree_->top(); }
+		public:
+			using iterator_category = __stl2::input_iterator_tag;
+			using value_type = iter_value_t<I>;
+			using difference_type = iter_difference_t<I>;
+
+			__iterator() = default;
+
+			constexpr explicit __iterator(merge_k_view& parent)
+			: parent_(&parent) {}
+
+			constexpr iter_reference_t<I> operator*() const
+			{ return *current(); }
+
+			__iterator& operator++()
+			{
+				parent_->tree_->pop(parent_->comp_.get(), parent_->proj_.get());
+				return *this;
+			}
+
+			void operator++(int)
+			{ ++*this; }
+
+			friend bool operator==(const __iterator& x, default_sentinel)
+			{ return x.done(); }
+			friend bool operator==(default_sentinel y, const __iterator& x)
+			{ return x == y; }
+			friend bool operator!=(const __iterator& x, default_sentinel y)
+			{ return !(x == y); }
+			friend bool operator!=(default_sentinel y, const __iterator& x)
+			{ return !(x == y); }
+
+			friend constexpr iter_rvalue_reference_t<I> iter_move(const __iterator& i)
+			noexcept(noexcept(__stl2::iter_move(std::declval<const I&>())))
+			{ return __stl2::iter_move(i.current()); }
+		};
+	} // namespace ext
+
+	namespace view::ext {
+		struct __merge_k_fn : detail::__pipeable<__merge_k_fn> {
+			template<InputRange R, class Comp = less, class Proj = identity>
+			requires ViewableRange<R> && detail::__mergeable_runs<R> &&
+				CopyConstructible<Comp> && CopyConstructible<Proj> &&
+				IndirectStrictWeakOrder<Comp,
+					projected<detail::__run_iterator_t<R>, Proj>>
+			constexpr auto operator()(R&& rng, Comp comp = {}, Proj proj = {}) const
+			{
+				return __stl2::ext::merge_k_view<all_view<R>, Comp, Proj>{
+					view::all(std::forward<R>(rng)), std::move(comp), std::move(proj)};
+			}
+
+			template<CopyConstructible Comp, CopyConstructible Proj = identity>
+			requires !Range<Comp>
+			constexpr auto operator()(Comp comp, Proj proj = {}) const
+			{ return detail::view_closure{*this, std::move(comp), std::move(proj)}; }
+		};
+
+		inline constexpr __merge_k_fn merge_k {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
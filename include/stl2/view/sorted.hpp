@@ -0,0 +1,260 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_SORTED_HPP
+#define STL2_VIEW_SORTED_HPP
+
+#include <memory>
+#include <vector>
+#include <stl2/functional.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/semiregular_box.hpp>
+#include <stl2/detail/swap.hpp>
+#include <stl2/detail/algorithm/nth_element.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/concepts/callable.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/primitives.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// sorted_view [Extension]
+// The elements of a random-access range in sorted order, sorted in place
+// only as far as they are read: partial_sort for when the number of
+// elements wanted is not known up front. Reading an element past the
+// sorted prefix halves the unsorted segment that holds it with
+// nth_element until the piece is small, remembering each split point on a
+// stack, then sorts the piece. Elements never cross a split point, so
+// later reads resume from the stack. Reading an element sorts every
+// element before it as well, so the first k elements cost O(n + k log k)
+// in all, however they are read; skipping some with drop saves nothing.
+//
+// The underlying range is permuted as the view is read; writing to it
+// through the view, or otherwise, breaks the order of the unread part.
+// Copies of the view permute the same elements, so they share their
+// progress: a page of a ranking read through one copy is not sorted
+// again when read through another. A view that is moved from starts over.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<View V, class Comp = less, class Proj = identity>
+		requires RandomAccessRange<V> && SizedRange<V> &&
+			CopyConstructible<Comp> && CopyConstructible<Proj> &&
+			Sortable<iterator_t<V>, Comp, Proj>
+		class sorted_view : public view_interface<sorted_view<V, Comp, Proj>> {
+		private:
+			class __iterator;
+			using D = iter_difference_t<iterator_t<V>>;
+
+			// Pieces of at most this many elements are sorted outright.
+			static constexpr D piece = 32;
+
+			V base_ = V();
+			detail::semiregular_box<Comp> comp_;
+			detail::semiregular_box<Proj> proj_;
+			// [0, sorted) is in its final order; each split point on the
+			// stack bounds the elements before it from those after it.
+			struct __progress {
+				D sorted = 0;
+				std::vector<D> splits;
+			};
+			std::shared_ptr<__progress> progress_ = std::make_shared<__progress>();
+
+			// Put element i in its final position.
+			void settle(D i)
+			{
+				if (i >= progress_->sorted) extend(i);
+			}
+
+			void extend(D i)
+			{
+				auto first = __stl2::begin(base_);
+				auto& comp = comp_.get();
+				auto& proj = proj_.get();
+				const D n = __stl2::distance(base_);
+				auto& [sorted, splits] = *progress_;
+				while (sorted <= i) {
+					D last = splits.empty() ? n : splits.back();
+					while (last - sorted > piece) {
+						const D mid = sorted + (last - sorted) / 2;
+						__stl2::nth_element(first + sorted, first + mid, first + last,
+							__stl2::ref(comp), __stl2::ref(proj));
+						splits.push_back(mid);
+						last = mid;
+					}
+					__stl2::sort(first + sorted, first + last,
+						__stl2::ref(comp), __stl2::ref(proj));
+					sorted = last;
+					if (!splits.empty()) splits.pop_back();
+				}
+			}
+
+		public:
+			sorted_view() = default;
+			sorted_view(const sorted_view&) = default;
+			// A moved-from view starts over with progress of its own.
+			sorted_view(sorted_view&& that)
+			: base_(std::move(that.base_)), comp_(std::move(that.comp_))
+			, proj_(std::move(that.proj_))
+			, progress_(__stl2::exchange(that.progress_, std::make_shared<__progress>()))
+			{}
+			sorted_view& operator=(const sorted_view&) = default;
+			sorted_view& operator=(sorted_view&& that)
+			{
+				base_ = std::move(that.base_);
+				comp_ = std::move(that.comp_);
+				proj_ = std::move(that.proj_);
+				progress_ = __stl2::exchange(that.progress_, std::make_shared<__progress>());
+				return *this;
+			}
+
+			constexpr explicit sorted_view(V base, Comp comp = {}, Proj proj = {})
+			: base_(std::move(base)), comp_(std::move(comp)), proj_(std::move(proj)) {}
+
+			constexpr V base() const { return base_; }
+
+			__iterator begin()
+			{ return __iterator{*this, 0}; }
+
+			__iterator end()
+			{ return __iterator{*this, __stl2::distance(base_)}; }
+
+			constexpr auto size() { return __stl2::size(base_); }
+			constexpr auto size() const requires SizedRange<const V>
+			{ return __stl2::size(base_); }
+		};
+
+		template<class R>
+		sorted_view(R&&) -> sorted_view<all_view<R>>;
+
+		template<class R, class Comp>
+		sorted_view(R&&, Comp) -> sorted_view<all_view<R>, Comp>;
+
+		template<class R, class Comp, class Proj>
+		sorted_view(R&&, Comp, Proj) -> sorted_view<all_view<R>, Comp, Proj>;
+
+		template<View V, class Comp, class Proj>
+		requires RandomAccessRange<V> && SizedRange<V> &&
+			CopyConstructible<Comp> && CopyConstructible<Proj> &&
+			Sortable<iterator_t<V>, Comp, Proj>
+		class sorted_view<V, Comp, Proj>::__iterator {
+		private:
+			using I = iterator_t<V>;
+			sorted_view* parent_ = nullptr;
+			D pos_ = 0;
+
+			I current() const
+			{
+				parent_->settle(pos_);
+				return __stl2::begin(parent_->base_) + pos_;
+			}
+		public:
+			using iterator_category = __stl2::random_access_iterator_tag;
+			using value_type = iter_value_t<I>;
+			using difference_type = D;
+
+			__iterator() = default;
+
+			constexpr __iterator(sorted_view& parent, D pos)
+			: parent_(&parent), pos_(pos) {}
+
+			iter_reference_t<I> operator*() const
+			{ return *current(); }
+
+			constexpr __iterator& operator++()
+			{
+				++pos_;
+				return *this;
+			}
+			constexpr __iterator operator++(int)
+			{
+				auto tmp = *this;
+				++*this;
+				return tmp;
+			}
+			constexpr __iterator& operator--()
+			{
+				--pos_;
+				return *this;
+			}
+			constexpr __iterator operator--(int)
+			{
+				auto tmp = *this;
+				--*this;
+				return tmp;
+			}
+			constexpr __iterator& operator+=(D n)
+			{
+				pos_ += n;
+				return *this;
+			}
+			constexpr __iterator& operator-=(D n)
+			{
+				pos_ -= n;
+				return *this;
+			}
+			iter_reference_t<I> operator[](D n) const
+			{ return *(*this + n); }
+
+			friend constexpr bool operator==(const __iterator& x, const __iterator& y)
+			{ return x.pos_ == y.pos_; }
+			friend constexpr bool operator!=(const __iterator& x, const __iterator& y)
+			{ return !(x == y); }
+			friend constexpr bool operator<(const __iterator& x, const __iterator& y)
+			{ return x.pos_ < y.pos_; }
+			friend constexpr bool operator>(const __iterator& x, const __iterator& y)
+			{ return y < x; }
+			friend constexpr bool operator<=(const __iterator& x, const __iterator& y)
+			{ return !(y < x); }
+			friend constexpr bool operator>=(const __iterator& x, const __iterator& y)
+			{ return !(x < y); }
+
+			friend constexpr __iterator operator+(__iterator i, D n)
+			{ return i += n; }
+			friend constexpr __iterator operator+(D n, __iterator i)
+			{ return i += n; }
+			friend constexpr __iterator operator-(__iterator i, D n)
+			{ return i -= n; }
+			friend constexpr D operator-(const __iterator& x, const __iterator& y)
+			{ return x.pos_ - y.pos_; }
+
+			friend iter_rvalue_reference_t<I> iter_move(const __iterator& i)
+			{ return __stl2::iter_move(i.current()); }
+		};
+	} // namespace ext
+
+	namespace view::ext {
+		struct __sorted_fn : detail::__pipeable<__sorted_fn> {
+			template<RandomAccessRange R, class Comp = less, class Proj = identity>
+			requires ViewableRange<R> && SizedRange<R> &&
+				CopyConstructible<Comp> && CopyConstructible<Proj> &&
+				Sortable<iterator_t<R>, Comp, Proj>
+			constexpr auto operator()(R&& rng, Comp comp = {}, Proj proj = {}) const
+			{
+				return __stl2::ext::sorted_view<all_view<R>, Comp, Proj>{
+					view::all(std::forward<R>(rng)), std::move(comp), std::move(proj)};
+			}
+
+			template<CopyConstructible Comp, CopyConstructible Proj = identity>
+			requires !Range<Comp>
+			constexpr auto operator()(Comp comp, Proj proj = {}) const
+			{ return detail::view_closure{*this, std::move(comp), std::move(proj)}; }
+		};
+
+		inline constexpr __sorted_fn sorted {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
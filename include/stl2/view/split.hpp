@@ -13,7 +13,9 @@
 #define STL2_VIEW_SPLIT_HPP
 
 #include <stl2/type_traits.hpp>
+#include <stl2/functional.hpp>
 #include <stl2/detail/fwd.hpp>
+#include <stl2/detail/algorithm/find_if.hpp>
 #include <stl2/detail/algorithm/mismatch.hpp>
 #include <stl2/detail/concepts/object.hpp>
 #include <stl2/detail/iterator/default_sentinel.hpp>
@@ -32,6 +34,16 @@ STL2_OPEN_NAMESPACE {
 		} &&
 		std::remove_reference_t<R>::size() <= 1;
 
+	// A range of elements that delimits the subranges as a whole, or an
+	// ext::char_set of characters each of which delimits them.
+	template<class Rng, class Pattern>
+	META_CONCEPT __split_pattern =
+		(ForwardRange<Pattern> && View<Pattern> &&
+		 IndirectlyComparable<iterator_t<Rng>, iterator_t<Pattern>, equal_to> &&
+		 (ForwardRange<Rng> || _TinyRange<Pattern>)) ||
+		(Same<Pattern, ext::char_set> && ForwardRange<Rng> &&
+		 IndirectUnaryPredicate<const ext::char_set, iterator_t<Rng>>);
+
 	template<InputRange Rng>
 	struct __split_view_base {
 		iterator_t<Rng> current_ {};
@@ -39,10 +51,8 @@ STL2_OPEN_NAMESPACE {
 	template<ForwardRange Rng>
 	struct __split_view_base<Rng> {};
 
-	template<InputRange Rng, ForwardRange Pattern>
-	requires View<Rng> && View<Pattern> &&
-		IndirectlyComparable<iterator_t<Rng>, iterator_t<Pattern>, equal_to> &&
-		(ForwardRange<Rng> || _TinyRange<Pattern>)
+	template<InputRange Rng, class Pattern>
+	requires View<Rng> && __split_pattern<Rng, Pattern>
 	struct split_view : private __split_view_base<Rng> {
 	private:
 		template<bool Const> struct __outer_iterator;
@@ -95,6 +105,9 @@ STL2_OPEN_NAMESPACE {
 	split_view(Rng&&, iter_value_t<iterator_t<Rng>>)
 		-> split_view<all_view<Rng>, single_view<iter_value_t<iterator_t<Rng>>>>;
 
+	template<InputRange Rng>
+	split_view(Rng&&, ext::char_set) -> split_view<all_view<Rng>, ext::char_set>;
+
 	template<class, bool>
 	struct __split_view_outer_base {};
 	template<ForwardRange Rng, bool Const>
@@ -102,10 +115,8 @@ STL2_OPEN_NAMESPACE {
 		iterator_t<__maybe_const<Const, Rng>> current_ {};
 	};
 
-	template<InputRange Rng, ForwardRange Pattern>
-	requires View<Rng> && View<Pattern> &&
-		IndirectlyComparable<iterator_t<Rng>, iterator_t<Pattern>, equal_to> &&
-		(ForwardRange<Rng> || _TinyRange<Pattern>)
+	template<InputRange Rng, class Pattern>
+	requires View<Rng> && __split_pattern<Rng, Pattern>
 	template<bool Const>
 	struct split_view<Rng, Pattern>::__outer_iterator
 	: private __split_view_outer_base<Rng, Const> {
@@ -157,17 +168,22 @@ STL2_OPEN_NAMESPACE {
 			auto& cur = current();
 			const auto end = __stl2::end(parent_->base_);
 			if (cur == end) return *this;
-			const auto [pbegin, pend] = subrange{parent_->pattern_};
-			if (pbegin == pend) ++cur;
-			else {
-				do {
-					const auto [b, p] = mismatch(cur, end, pbegin, pend);
-					if (p == pend) {
-						// The pattern matches, skip it
-						cur = b;
-						break;
-					}
-				} while (++cur != end);
+			if constexpr (Same<Pattern, ext::char_set>) {
+				cur = find_if(std::move(cur), end, __stl2::ref(parent_->pattern_));
+				if (cur != end) ++cur;
+			} else {
+				const auto [pbegin, pend] = subrange{parent_->pattern_};
+				if (pbegin == pend) ++cur;
+				else {
+					do {
+						const auto [b, p] = mismatch(cur, end, pbegin, pend);
+						if (p == pend) {
+							// The pattern matches, skip it
+							cur = b;
+							break;
+						}
+					} while (++cur != end);
+				}
 			}
 			return *this;
 		}
@@ -200,10 +216,8 @@ STL2_OPEN_NAMESPACE {
 		{ return !(y == x);	}
 	};
 
-	template<InputRange Rng, ForwardRange Pattern>
-	requires View<Rng> && View<Pattern> &&
-		IndirectlyComparable<iterator_t<Rng>, iterator_t<Pattern>, equal_to> &&
-		(ForwardRange<Rng> || _TinyRange<Pattern>)
+	template<InputRange Rng, class Pattern>
+	requires View<Rng> && __split_pattern<Rng, Pattern>
 	template<bool Const>
 	struct split_view<Rng, Pattern>::__outer_iterator<Const>::value_type {
 	private:
@@ -220,10 +234,8 @@ STL2_OPEN_NAMESPACE {
 		{ return default_sentinel{}; }
 	};
 
-	template<InputRange Rng, ForwardRange Pattern>
-	requires View<Rng> && View<Pattern> &&
-		IndirectlyComparable<iterator_t<Rng>, iterator_t<Pattern>, equal_to> &&
-		(ForwardRange<Rng> || _TinyRange<Pattern>)
+	template<InputRange Rng, class Pattern>
+	requires View<Rng> && __split_pattern<Rng, Pattern>
 	template<bool Const>
 	struct split_view<Rng, Pattern>::__inner_iterator {
 	private:
@@ -276,13 +288,17 @@ STL2_OPEN_NAMESPACE {
 			auto cur = x.i_.current();
 			auto end = __stl2::end(x.i_.parent_->base_);
 			if (cur == end) return true;
-			auto [pcur, pend] = subrange{x.i_.parent_->pattern_};
-			if (pcur == pend) return x.zero_;
-			do {
-				if (*cur != *pcur) return false;
-				if (++pcur == pend) return true;
-			} while (++cur != end);
-			return false;
+			if constexpr (Same<Pattern, ext::char_set>) {
+				return x.i_.parent_->pattern_(*cur);
+			} else {
+				auto [pcur, pend] = subrange{x.i_.parent_->pattern_};
+				if (pcur == pend) return x.zero_;
+				do {
+					if (*cur != *pcur) return false;
+					if (++pcur == pend) return true;
+				} while (++cur != end);
+				return false;
+			}
 		}
 		friend constexpr bool operator==(default_sentinel x, const __inner_iterator& y)
 		{ return y == x; }
@@ -0,0 +1,315 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_TRANSFORM_CACHED_HPP
+#define STL2_VIEW_TRANSFORM_CACHED_HPP
+
+#include <optional>
+#include <type_traits>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/semiregular_box.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/functional/invoke.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/view/view_closure.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// transform_cached_view [Extension]
+// Like transform_view, but each iterator remembers the result of applying
+// the function at its current position, so that algorithms which
+// dereference a position several times - max_element, minmax_element,
+// adjacent_find, is_sorted_until - invoke the function once per position
+// an iterator visits rather than once per dereference. Moving an iterator
+// discards its memo; copying it copies the memo.
+//
+// Since the memo lives in the iterator, dereferencing yields the value by
+// copy rather than a reference into the iterator; that keeps references
+// from dangling when an algorithm dereferences a temporary iterator.
+// Prefer transform_view when the function is cheap or returns a reference.
+//
+STL2_OPEN_NAMESPACE {
+	namespace ext {
+		template<InputRange V, CopyConstructible F>
+		requires View<V> && std::is_object_v<F> &&
+			RegularInvocable<F&, iter_reference_t<iterator_t<V>>> &&
+			CopyConstructible<__uncvref<invoke_result_t<F&, iter_reference_t<iterator_t<V>>>>>
+		class transform_cached_view
+		: public view_interface<transform_cached_view<V, F>> {
+		private:
+			template<bool> class __iterator;
+			template<bool> class __sentinel;
+
+			V base_ = V();
+			detail::semiregular_box<F> fun_;
+
+		public:
+			transform_cached_view() = default;
+
+			constexpr transform_cached_view(V base, F fun)
+			: base_(std::move(base)), fun_(std::move(fun)) {}
+
+			constexpr V base() const { return base_; }
+
+			constexpr __iterator<false> begin()
+			{ return {*this, __stl2::begin(base_)}; }
+
+			// Template to work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=82507
+			template<class ConstV = const V>
+			constexpr __iterator<true> begin() const requires Range<ConstV> &&
+				RegularInvocable<const F&, iter_reference_t<iterator_t<ConstV>>>
+			{ return {*this, __stl2::begin(base_)}; }
+
+			constexpr auto end() {
+				if constexpr (CommonRange<V>) {
+					return __iterator<false>{*this, __stl2::end(base_)};
+				} else {
+					return __sentinel<false>{__stl2::end(base_)};
+				}
+			}
+
+			// Template to work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=82507
+			template<class ConstV = const V>
+			constexpr auto end() const requires Range<ConstV> &&
+				RegularInvocable<const F&, iter_reference_t<iterator_t<ConstV>>>
+			{
+				if constexpr (CommonRange<const V>) {
+					return __iterator<true>{*this, __stl2::end(base_)};
+				} else {
+					return __sentinel<true>{__stl2::end(base_)};
+				}
+			}
+
+			constexpr auto size() requires SizedRange<V>
+			{ return __stl2::size(base_); }
+
+			constexpr auto size() const requires SizedRange<const V>
+			{ return __stl2::size(base_); }
+		};
+
+		template<class R, class F>
+		transform_cached_view(R&& r, F fun) -> transform_cached_view<all_view<R>, F>;
+
+		template<InputRange V, CopyConstructible F>
+		requires View<V> && std::is_object_v<F> &&
+			RegularInvocable<F&, iter_reference_t<iterator_t<V>>> &&
+			CopyConstructible<__uncvref<invoke_result_t<F&, iter_reference_t<iterator_t<V>>>>>
+		template<bool Const>
+		class transform_cached_view<V, F>::__iterator {
+		private:
+			using Parent = __maybe_const<Const, transform_cached_view>;
+			using Base = __maybe_const<Const, V>;
+			using Fun = __maybe_const<Const, F>;
+		public:
+			using iterator_category = iterator_category_t<iterator_t<Base>>;
+			using value_type =
+				__uncvref<invoke_result_t<Fun&, iter_reference_t<iterator_t<Base>>>>;
+			using difference_type = iter_difference_t<iterator_t<Base>>;
+		private:
+			iterator_t<Base> current_ {};
+			Parent* parent_ = nullptr;
+			mutable std::optional<value_type> memo_;
+			friend __iterator<!Const>;
+			friend __sentinel<Const>;
+
+			constexpr value_type compute(const iterator_t<Base>& i) const
+			{ return invoke(parent_->fun_.get(), *i); }
+
+			constexpr const value_type& get() const {
+				if (!memo_) {
+					memo_.emplace(compute(current_));
+				}
+				return *memo_;
+			}
+		public:
+			__iterator() = default;
+
+			constexpr __iterator(Parent& parent, iterator_t<Base> current)
+			: current_(current), parent_(&parent) {}
+
+			constexpr __iterator(__iterator<!Const> i)
+			requires Const && ConvertibleTo<iterator_t<V>, iterator_t<Base>>
+			: current_(std::move(i.current_)), parent_(i.parent_) {}
+
+			constexpr iterator_t<Base> base() const
+			{ return current_; }
+			constexpr value_type operator*() const
+			{ return get(); }
+
+			constexpr __iterator& operator++()
+			{
+				++current_;
+				memo_.reset();
+				return *this;
+			}
+			constexpr void operator++(int)
+			{ ++*this; }
+			constexpr __iterator operator++(int) requires ForwardRange<Base>
+			{
+				auto tmp = *this;
+				++*this;
+				return tmp;
+			}
+
+			constexpr __iterator& operator--() requires BidirectionalRange<Base>
+			{
+				--current_;
+				memo_.reset();
+				return *this;
+			}
+			constexpr __iterator operator--(int) requires BidirectionalRange<Base>
+			{
+				auto tmp = *this;
+				--*this;
+				return tmp;
+			}
+
+			constexpr __iterator& operator+=(difference_type n)
+			requires RandomAccessRange<Base>
+			{
+				if (n != 0) {
+					current_ += n;
+					memo_.reset();
+				}
+				return *this;
+			}
+			constexpr __iterator& operator-=(difference_type n)
+			requires RandomAccessRange<Base>
+			{ return *this += -n; }
+			constexpr value_type operator[](difference_type n) const
+			requires RandomAccessRange<Base>
+			{ return n == 0 ? get() : compute(current_ + n); }
+
+			friend constexpr bool operator==(const __iterator& x, const __iterator& y)
+			requires EqualityComparable<iterator_t<Base>>
+			{ return x.current_ == y.current_; }
+
+			friend constexpr bool operator!=(const __iterator& x, const __iterator& y)
+			requires EqualityComparable<iterator_t<Base>>
+			{ return !(x == y); }
+
+			friend constexpr bool operator<(const __iterator& x, const __iterator& y)
+			requires RandomAccessRange<Base>
+			{ return x.current_ < y.current_; }
+
+			friend constexpr bool operator>(const __iterator& x, const __iterator& y)
+			requires RandomAccessRange<Base>
+			{ return y < x; }
+
+			friend constexpr bool operator<=(const __iterator& x, const __iterator& y)
+			requires RandomAccessRange<Base>
+			{ return !(y < x); }
+
+			friend constexpr bool operator>=(const __iterator& x, const __iterator& y)
+			requires RandomAccessRange<Base>
+			{ return !(x < y); }
+
+			friend constexpr __iterator operator+(__iterator i, difference_type n)
+			requires RandomAccessRange<Base>
+			{ return i += n; }
+
+			friend constexpr __iterator operator+(difference_type n, __iterator i)
+			requires RandomAccessRange<Base>
+			{ return i += n; }
+
+			friend constexpr __iterator operator-(__iterator i, difference_type n)
+			requires RandomAccessRange<Base>
+			{ return i -= n; }
+
+			friend constexpr difference_type operator-(const __iterator& x, const __iterator& y)
+			requires RandomAccessRange<Base>
+			{ return x.current_ - y.current_; }
+
+			// The memo is the iterator's own, so it may be moved from.
+			friend constexpr value_type iter_move(const __iterator& i)
+			{
+				if (!i.memo_) return i.compute(i.current_);
+				value_type result = std::move(*i.memo_);
+				i.memo_.reset();
+				return result;
+			}
+		};
+
+		template<InputRange V, CopyConstructible F>
+		requires View<V> && std::is_object_v<F> &&
+			RegularInvocable<F&, iter_reference_t<iterator_t<V>>> &&
+			CopyConstructible<__uncvref<invoke_result_t<F&, iter_reference_t<iterator_t<V>>>>>
+		template<bool Const>
+		class transform_cached_view<V, F>::__sentinel {
+		private:
+			using Base = __maybe_const<Const, V>;
+			sentinel_t<Base> end_ {};
+			friend __sentinel<!Const>;
+
+			constexpr bool equal(const __iterator<Const>& i) const
+			{ return i.current_ == end_; }
+			constexpr iter_difference_t<iterator_t<Base>>
+			distance(const __iterator<Const>& i) const
+			{ return end_ - i.current_; }
+		public:
+			__sentinel() = default;
+			explicit constexpr __sentinel(sentinel_t<Base> end)
+			: end_(end) {}
+			constexpr __sentinel(__sentinel<!Const> i)
+			requires Const && ConvertibleTo<sentinel_t<V>, sentinel_t<Base>>
+			: end_(std::move(i.end_)) {}
+
+			constexpr sentinel_t<Base> base() const
+			{ return end_; }
+
+			friend constexpr bool operator==(const __iterator<Const>& x, const __sentinel& y)
+			{ return y.equal(x); }
+
+			friend constexpr bool operator==(const __sentinel& x, const __iterator<Const>& y)
+			{ return x.equal(y); }
+
+			friend constexpr bool operator!=(const __iterator<Const>& x, const __sentinel& y)
+			{ return !y.equal(x); }
+
+			friend constexpr bool operator!=(const __sentinel& x, const __iterator<Const>& y)
+			{ return !x.equal(y); }
+
+			friend constexpr iter_difference_t<iterator_t<Base>>
+			operator-(const __iterator<Const>& x, const __sentinel& y)
+			requires SizedSentinel<sentinel_t<Base>, iterator_t<Base>>
+			{ return -y.distance(x); }
+
+			friend constexpr iter_difference_t<iterator_t<Base>>
+			operator-(const __sentinel& y, const __iterator<Const>& x)
+			requires SizedSentinel<sentinel_t<Base>, iterator_t<Base>>
+			{ return y.distance(x); }
+		};
+	} // namespace ext
+
+	namespace view::ext {
+		struct __transform_cached_fn {
+			template<InputRange Rng, CopyConstructible F>
+			requires ViewableRange<Rng> &&
+				Invocable<F&, iter_reference_t<iterator_t<Rng>>>
+			constexpr auto operator()(Rng&& rng, F fun) const {
+				return __stl2::ext::transform_cached_view{
+					std::forward<Rng>(rng), std::move(fun)};
+			}
+
+			template<CopyConstructible F>
+			constexpr auto operator()(F fun) const {
+				return detail::view_closure{*this, std::move(fun)};
+			}
+		};
+
+		inline constexpr __transform_cached_fn transform_cached {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
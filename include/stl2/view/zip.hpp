@@ -0,0 +1,387 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#ifndef STL2_VIEW_ZIP_HPP
+#define STL2_VIEW_ZIP_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <stl2/type_traits.hpp>
+#include <stl2/detail/common_tuple.hpp>
+#include <stl2/detail/fwd.hpp>
+#include <stl2/detail/meta.hpp>
+#include <stl2/detail/iterator/concepts.hpp>
+#include <stl2/detail/range/access.hpp>
+#include <stl2/detail/range/concepts.hpp>
+#include <stl2/detail/range/primitives.hpp>
+#include <stl2/view/all.hpp>
+#include <stl2/view/view_interface.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// zip_view [Extension]
+// The ranges rs... side by side: element i is the common_tuple of the i-th
+// elements of each, the length is that of the shortest range, and the
+// view is as strong a category as the weakest of them. Elements are proxy
+// references to the underlying elements, so algorithms that permute - sort,
+// rotate, partition - rearrange all of the ranges in lockstep; iter_move
+// and iter_swap forward to the underlying iterators element by element,
+// which moves and swaps each column directly rather than materializing
+// tuples. This sorts a struct of arrays as though it were an array of
+// structs.
+//
+STL2_OPEN_NAMESPACE {
+	namespace detail {
+		template<class... Rs>
+		META_CONCEPT __zip_is_common =
+			(sizeof...(Rs) == 1 && (CommonRange<Rs> && ...)) ||
+			(!(BidirectionalRange<Rs> && ...) && (CommonRange<Rs> && ...)) ||
+			((RandomAccessRange<Rs> && ...) && (SizedRange<Rs> && ...));
+
+		template<class... Rs>
+		using __zip_category = meta::if_c<(RandomAccessRange<Rs> && ...),
+			random_access_iterator_tag,
+			meta::if_c<(BidirectionalRange<Rs> && ...),
+				bidirectional_iterator_tag,
+				meta::if_c<(ForwardRange<Rs> && ...),
+					forward_iterator_tag,
+					input_iterator_tag>>>;
+
+		// Elementwise operations on tuples of iterators and sentinels
+		template<class T, class U, std::size_t... Is>
+		constexpr bool __zip_any_equal(const T& t, const U& u, std::index_sequence<Is...>)
+		{ return ((std::get<Is>(t) == std::get<Is>(u)) || ...); }
+
+		// The difference of smallest magnitude between corresponding elements.
+		template<class D, class T, class U, std::size_t... Is>
+		constexpr D __zip_min_distance(const T& t, const U& u, std::index_sequence<Is...>)
+		{
+			const D ds[] = {static_cast<D>(std::get<Is>(t) - std::get<Is>(u))...};
+			D result = ds[0];
+			for (D d : ds) {
+				if ((d < 0 ? -d : d) < (result < 0 ? -result : result)) {
+					result = d;
+				}
+			}
+			return result;
+		}
+
+		template<class T, std::size_t... Is>
+		constexpr void __zip_iter_swap(const T& t, const T& u, std::index_sequence<Is...>)
+		{ (__stl2::iter_swap(std::get<Is>(t), std::get<Is>(u)), ...); }
+	}
+
+	namespace ext {
+		template<InputRange... Vs>
+		requires sizeof...(Vs) > 0 && (View<Vs> && ...)
+		class zip_view : public view_interface<zip_view<Vs...>> {
+		private:
+			template<bool> class __iterator;
+			template<bool> class __sentinel;
+
+			std::tuple<Vs...> bases_;
+
+			template<bool Const, class Self>
+			static constexpr __iterator<Const> begin_impl(Self& self) {
+				return std::apply([](auto&... bases) {
+					return __iterator<Const>{__stl2::begin(bases)...};
+				}, self.bases_);
+			}
+
+			template<bool Const, class Self>
+			static constexpr auto end_impl(Self& self) {
+				if constexpr ((RandomAccessRange<__maybe_const<Const, Vs>> && ...) &&
+					(SizedRange<__maybe_const<Const, Vs>> && ...))
+				{
+					using D = iter_difference_t<__iterator<Const>>;
+					return begin_impl<Const>(self) + static_cast<D>(size_impl(self));
+				} else if constexpr (detail::__zip_is_common<__maybe_const<Const, Vs>...>) {
+					return std::apply([](auto&... bases) {
+						return __iterator<Const>{__stl2::end(bases)...};
+					}, self.bases_);
+				} else {
+					return std::apply([](auto&... bases) {
+						return __sentinel<Const>{__stl2::end(bases)...};
+					}, self.bases_);
+				}
+			}
+
+			template<class Self>
+			static constexpr auto size_impl(Self& self) {
+				return std::apply([](auto&... bases) {
+					using S = std::common_type_t<decltype(__stl2::size(bases))...>;
+					const S sizes[] = {static_cast<S>(__stl2::size(bases))...};
+					S result = sizes[0];
+					for (S s : sizes) {
+						if (s < result) result = s;
+					}
+					return result;
+				}, self.bases_);
+			}
+		public:
+			zip_view() = default;
+
+			constexpr explicit zip_view(Vs... bases)
+			: bases_(std::move(bases)...) {}
+
+			constexpr __iterator<false> begin()
+			{ return begin_impl<false>(*this); }
+
+			// Template to work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=82507
+			template<bool B = true>
+			constexpr __iterator<true> begin() const
+			requires B && (Range<const Vs> && ...)
+			{ return begin_impl<true>(*this); }
+
+			constexpr auto end()
+			{ return end_impl<false>(*this); }
+
+			template<bool B = true>
+			constexpr auto end() const
+			requires B && (Range<const Vs> && ...)
+			{ return end_impl<true>(*this); }
+
+			constexpr auto size() requires (SizedRange<Vs> && ...)
+			{ return size_impl(*this); }
+
+			constexpr auto size() const requires (SizedRange<const Vs> && ...)
+			{ return size_impl(*this); }
+		};
+
+		template<class... Rs>
+		zip_view(Rs&&...) -> zip_view<all_view<Rs>...>;
+
+		template<InputRange... Vs>
+		requires sizeof...(Vs) > 0 && (View<Vs> && ...)
+		template<bool Const>
+		class zip_view<Vs...>::__iterator {
+		private:
+			template<class V>
+			using I = iterator_t<__maybe_const<Const, V>>;
+			using indices = std::index_sequence_for<Vs...>;
+			static constexpr bool all_forward =
+				(ForwardRange<__maybe_const<Const, Vs>> && ...);
+			static constexpr bool all_bidi =
+				(BidirectionalRange<__maybe_const<Const, Vs>> && ...);
+			static constexpr bool all_random =
+				(RandomAccessRange<__maybe_const<Const, Vs>> && ...);
+
+			std::tuple<I<Vs>...> current_;
+			friend __iterator<!Const>;
+			friend __sentinel<Const>;
+		public:
+			using iterator_category =
+				detail::__zip_category<__maybe_const<Const, Vs>...>;
+			using value_type = std::tuple<iter_value_t<I<Vs>>...>;
+			using difference_type = std::common_type_t<iter_difference_t<I<Vs>>...>;
+			using reference = common_tuple<iter_reference_t<I<Vs>>...>;
+
+			__iterator() = default;
+
+			constexpr explicit __iterator(I<Vs>... current)
+			: current_(std::move(current)...) {}
+
+			constexpr __iterator(__iterator<!Const> i)
+			requires Const && (ConvertibleTo<iterator_t<Vs>, I<Vs>> && ...)
+			: current_(std::move(i.current_)) {}
+
+			constexpr const std::tuple<I<Vs>...>& base() const
+			{ return current_; }
+
+			constexpr reference operator*() const
+			{
+				return std::apply([](auto&... is) { return reference(*is...); },
+					current_);
+			}
+
+			constexpr __iterator& operator++()
+			{
+				std::apply([](auto&... is) { (++is, ...); }, current_);
+				return *this;
+			}
+			constexpr void operator++(int)
+			{ ++*this; }
+			constexpr __iterator operator++(int) requires all_forward
+			{
+				auto tmp = *this;
+				++*this;
+				return tmp;
+			}
+
+			constexpr __iterator& operator--() requires all_bidi
+			{
+				std::apply([](auto&... is) { (--is, ...); }, current_);
+				return *this;
+			}
+			constexpr __iterator operator--(int) requires all_bidi
+			{
+				auto tmp = *this;
+				--*this;
+				return tmp;
+			}
+
+			constexpr __iterator& operator+=(difference_type n)
+			requires all_random
+			{
+				std::apply([n](auto&... is) {
+					((is += static_cast<iter_difference_t<__uncvref<decltype(is)>>>(n)), ...);
+				}, current_);
+				return *this;
+			}
+			constexpr __iterator& operator-=(difference_type n)
+			requires all_random
+			{
+				std::apply([n](auto&... is) {
+					((is -= static_cast<iter_difference_t<__uncvref<decltype(is)>>>(n)), ...);
+				}, current_);
+				return *this;
+			}
+			constexpr reference operator[](difference_type n) const
+			requires all_random
+			{ return *(*this + n); }
+
+			// Iterators of bidirectional zips are equal when all of their
+			// elements are; otherwise, when any is - so that zip_view of ranges
+			// of different lengths ends with the shortest.
+			friend constexpr bool operator==(const __iterator& x, const __iterator& y)
+			requires (EqualityComparable<I<Vs>> && ...)
+			{
+				if constexpr (all_bidi) {
+					return x.current_ == y.current_;
+				} else {
+					return detail::__zip_any_equal(x.current_, y.current_, indices{});
+				}
+			}
+
+			friend constexpr bool operator!=(const __iterator& x, const __iterator& y)
+			requires (EqualityComparable<I<Vs>> && ...)
+			{ return !(x == y); }
+
+			friend constexpr bool operator<(const __iterator& x, const __iterator& y)
+			requires all_random
+			{ return x.current_ < y.current_; }
+
+			friend constexpr bool operator>(const __iterator& x, const __iterator& y)
+			requires all_random
+			{ return y < x; }
+
+			friend constexpr bool operator<=(const __iterator& x, const __iterator& y)
+			requires all_random
+			{ return !(y < x); }
+
+			friend constexpr bool operator>=(const __iterator& x, const __iterator& y)
+			requires all_random
+			{ return !(x < y); }
+
+			friend constexpr __iterator operator+(__iterator i, difference_type n)
+			requires all_random
+			{ return i += n; }
+
+			friend constexpr __iterator operator+(difference_type n, __iterator i)
+			requires all_random
+			{ return i += n; }
+
+			friend constexpr __iterator operator-(__iterator i, difference_type n)
+			requires all_random
+			{ return i -= n; }
+
+			friend constexpr difference_type operator-(const __iterator& x, const __iterator& y)
+			requires (SizedSentinel<I<Vs>, I<Vs>> && ...)
+			{
+				return detail::__zip_min_distance<difference_type>(
+					x.current_, y.current_, indices{});
+			}
+
+			friend constexpr common_tuple<iter_rvalue_reference_t<I<Vs>>...>
+			iter_move(const __iterator& i)
+			noexcept((noexcept(__stl2::iter_move(std::declval<const I<Vs>&>())) && ...))
+			{
+				return std::apply([](auto&... is) {
+					return common_tuple<iter_rvalue_reference_t<I<Vs>>...>(
+						__stl2::iter_move(is)...);
+				}, i.current_);
+			}
+
+			friend constexpr void iter_swap(const __iterator& x, const __iterator& y)
+			noexcept((noexcept(__stl2::iter_swap(std::declval<const I<Vs>&>(),
+				std::declval<const I<Vs>&>())) && ...))
+			requires (IndirectlySwappable<I<Vs>> && ...)
+			{ detail::__zip_iter_swap(x.current_, y.current_, indices{}); }
+		};
+
+		template<InputRange... Vs>
+		requires sizeof...(Vs) > 0 && (View<Vs> && ...)
+		template<bool Const>
+		class zip_view<Vs...>::__sentinel {
+		private:
+			template<class V>
+			using I = iterator_t<__maybe_const<Const, V>>;
+			template<class V>
+			using S = sentinel_t<__maybe_const<Const, V>>;
+			using indices = std::index_sequence_for<Vs...>;
+			using D = iter_difference_t<__iterator<Const>>;
+
+			std::tuple<S<Vs>...> end_;
+			friend __sentinel<!Const>;
+
+			constexpr bool equal(const __iterator<Const>& i) const
+			{ return detail::__zip_any_equal(i.current_, end_, indices{}); }
+
+			constexpr D distance(const __iterator<Const>& i) const
+			{ return detail::__zip_min_distance<D>(end_, i.current_, indices{}); }
+		public:
+			__sentinel() = default;
+
+			constexpr explicit __sentinel(S<Vs>... end)
+			: end_(std::move(end)...) {}
+
+			constexpr __sentinel(__sentinel<!Const> s)
+			requires Const && (ConvertibleTo<sentinel_t<Vs>, S<Vs>> && ...)
+			: end_(std::move(s.end_)) {}
+
+			friend constexpr bool operator==(const __iterator<Const>& x, const __sentinel& y)
+			{ return y.equal(x); }
+
+			friend constexpr bool operator==(const __sentinel& x, const __iterator<Const>& y)
+			{ return x.equal(y); }
+
+			friend constexpr bool operator!=(const __iterator<Const>& x, const __sentinel& y)
+			{ return !y.equal(x); }
+
+			friend constexpr bool operator!=(const __sentinel& x, const __iterator<Const>& y)
+			{ return !x.equal(y); }
+
+			friend constexpr D operator-(const __iterator<Const>& x, const __sentinel& y)
+			requires (SizedSentinel<S<Vs>, I<Vs>> && ...)
+			{ return -y.distance(x); }
+
+			friend constexpr D operator-(const __sentinel& x, const __iterator<Const>& y)
+			requires (SizedSentinel<S<Vs>, I<Vs>> && ...)
+			{ return x.distance(y); }
+		};
+	} // namespace ext
+
+	namespace view::ext {
+		struct __zip_fn {
+			template<InputRange... Rs>
+			requires sizeof...(Rs) > 0 && (ViewableRange<Rs> && ...)
+			constexpr auto operator()(Rs&&... rs) const
+			STL2_REQUIRES_RETURN(
+				__stl2::ext::zip_view{view::all(std::forward<Rs>(rs))...}
+			)
+		};
+
+		inline constexpr __zip_fn zip {};
+	} // namespace view::ext
+} STL2_CLOSE_NAMESPACE
+
+#endif
@@ -0,0 +1,74 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/apply_permutation.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/is_sorted.hpp>
+#include <stl2/detail/algorithm/sort_indices.hpp>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using ranges::ext::apply_permutation;
+	using ranges::ext::sort_indices;
+
+	{
+		std::vector<int> p = {2, 0, 1, 3, 5, 4};
+		char c[] = {'a', 'b', 'c', 'd', 'e', 'f'};
+		std::vector<std::string> s = {"A", "B", "C", "D", "E", "F", "extra"};
+		apply_permutation(p, c, s);
+		CHECK_EQUAL(c, {'c', 'a', 'b', 'd', 'f', 'e'});
+		CHECK_EQUAL(s, {"C", "A", "B", "D", "F", "E", "extra"});
+		CHECK_EQUAL(p, {2, 0, 1, 3, 5, 4});
+	}
+	{
+		// Sort parallel columns by one of them.
+		std::vector<int> key = {3, 1, 2, 1, 0};
+		std::vector<std::string> name = {"d", "b", "c", "b2", "a"};
+		std::vector<std::unique_ptr<int>> ptr;
+		for (int i = 0; i < 5; ++i) ptr.push_back(std::make_unique<int>(i));
+		auto p = sort_indices(key);
+		apply_permutation(p, key, name, ptr);
+		CHECK_EQUAL(key, {0, 1, 1, 2, 3});
+		CHECK_EQUAL(name, {"a", "b", "b2", "c", "d"});
+		int order[] = {4, 1, 3, 2, 0};
+		CHECK(ranges::equal(ptr, order, ranges::equal_to{},
+			[](const std::unique_ptr<int>& q) { return *q; }));
+	}
+	{
+		std::vector<long> p;
+		std::vector<int> v;
+		apply_permutation(p, v);
+		p = {0};
+		v = {42};
+		apply_permutation(p, v);
+		CHECK_EQUAL(v, {42});
+	}
+	{
+		std::mt19937 gen;
+		std::uniform_int_distribution<int> dist{-1000, 1000};
+		std::vector<int> v(5000);
+		for (auto& x : v) x = dist(gen);
+		auto orig = v;
+		auto p = sort_indices(v);
+		std::vector<int> w(v.size());
+		for (std::size_t i = 0; i < p.size(); ++i) w[i] = v[p[i]];
+		apply_permutation(p, v);
+		CHECK(ranges::is_sorted(v));
+		CHECK(ranges::equal(v, w));
+		for (std::size_t i = 0; i < p.size(); ++i) CHECK(v[i] == orig[p[i]]);
+	}
+
+	return ::test_result();
+}
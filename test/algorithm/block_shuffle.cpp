@@ -0,0 +1,151 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/block_shuffle.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct throwing_move {
+		int value = 0;
+		throwing_move() = default;
+		throwing_move(int v) : value{v} {}
+		throwing_move(throwing_move&& that) noexcept(false) : value{that.value} {}
+		throwing_move& operator=(throwing_move&& that) noexcept(false) {
+			value = that.value;
+			return *this;
+		}
+	};
+
+	bool is_permutation_of_iota(std::vector<int> v) {
+		std::sort(v.begin(), v.end());
+		for (std::size_t i = 0; i < v.size(); ++i) {
+			if (v[i] != static_cast<int>(i)) return false;
+		}
+		return true;
+	}
+
+	// Loose checks that v is a uniform permutation of 0, ..., n - 1: about
+	// one in eight elements stays in its eighth of the range, about one
+	// fixed point, about half the neighbours ascend.
+	bool looks_uniform(const std::vector<int>& v) {
+		const auto n = static_cast<double>(v.size());
+		double same_eighth = 0, fixed = 0, ascents = 0;
+		for (std::size_t i = 0; i < v.size(); ++i) {
+			const auto x = static_cast<std::size_t>(v[i]);
+			same_eighth += (x * 8 / v.size()) == (i * 8 / v.size());
+			fixed += x == i;
+			if (i + 1 < v.size()) ascents += v[i] < v[i + 1];
+		}
+		const double sd = std::sqrt(n);
+		return std::abs(same_eighth - n / 8) < 4 * sd &&
+			fixed < 10 && std::abs(ascents - n / 2) < 4 * sd;
+	}
+}
+
+int main() {
+	using ranges::ext::block_shuffle;
+
+	{
+		// The workers run at once: each waits to see all the others arrive,
+		// which a serial run would never let it do.
+		constexpr unsigned workers = 4;
+		std::atomic<unsigned> arrived{0}, met{0};
+		const auto started = ranges::detail::__parallel_for(workers, [&](unsigned) {
+			++arrived;
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+			while (arrived.load() < workers && std::chrono::steady_clock::now() < deadline) {
+				std::this_thread::yield();
+			}
+			met += arrived.load() == workers;
+		});
+		CHECK(started == workers - 1);
+		CHECK(met.load() == workers);
+	}
+
+	// Big enough for several blocks.
+	constexpr int n = 3 << 20;
+	std::vector<int> v(n);
+	std::iota(v.begin(), v.end(), 0);
+
+	{
+		ranges::ext::xoshiro256pp g{1};
+		CHECK(block_shuffle(v, g) == v.end());
+		CHECK(is_permutation_of_iota(v));
+		CHECK(looks_uniform(v));
+	}
+	{
+		std::iota(v.begin(), v.end(), 0);
+		std::mt19937 g{2};
+		CHECK(block_shuffle(v.begin(), v.end(), g, 4) == v.end());
+		CHECK(is_permutation_of_iota(v));
+		CHECK(looks_uniform(v));
+
+		// The same seed and workers give the same permutation.
+		auto w = v;
+		std::iota(v.begin(), v.end(), 0);
+		std::iota(w.begin(), w.end(), 0);
+		g.seed(3);
+		block_shuffle(v, g, 4);
+		g.seed(3);
+		block_shuffle(w, g, 4);
+		CHECK(v == w);
+	}
+	{
+		std::iota(v.begin(), v.end(), 0);
+		block_shuffle(v, ranges::detail::get_random_engine(), 0);
+		CHECK(is_permutation_of_iota(v));
+		CHECK(looks_uniform(v));
+	}
+	{
+		// More workers than blocks.
+		std::iota(v.begin(), v.end(), 0);
+		block_shuffle(v, ranges::detail::get_random_engine(), 1000);
+		CHECK(is_permutation_of_iota(v));
+		CHECK(looks_uniform(v));
+	}
+	{
+		// Small ranges, and elements whose moves may throw, are shuffled
+		// in place.
+		std::vector<int> small(1000);
+		std::iota(small.begin(), small.end(), 0);
+		block_shuffle(small);
+		CHECK(is_permutation_of_iota(small));
+		CHECK(!std::is_sorted(small.begin(), small.end()));
+
+		std::vector<throwing_move> t(n / 4);
+		for (int i = 0; i < n / 4; ++i) t[i].value = i;
+		block_shuffle(t, ranges::detail::get_random_engine(), 2);
+		std::vector<int> values;
+		for (auto& x : t) values.push_back(x.value);
+		CHECK(is_permutation_of_iota(values));
+	}
+	{
+		std::vector<std::string> s(1 << 18);
+		for (std::size_t i = 0; i < s.size(); ++i) s[i] = std::to_string(i);
+		auto sorted = s;
+		block_shuffle(s, ranges::detail::get_random_engine(), 3);
+		CHECK(s != sorted);
+		std::sort(s.begin(), s.end());
+		std::sort(sorted.begin(), sorted.end());
+		CHECK(s == sorted);
+	}
+
+	return ::test_result();
+}
@@ -10,11 +10,112 @@
 // Project home: https://github.com/caseycarter/cmcstl2
 //
 #include <stl2/detail/algorithm/copy_if.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
 #include "../simple_test.hpp"
 
 namespace ranges = __stl2;
 
+namespace {
+	// Values around zero and the extremes of T. (No NaN: the tests are
+	// built with -Ofast.)
+	template<class T>
+	std::vector<T> values(std::size_t n) {
+		using L = std::numeric_limits<T>;
+		const T special[] = {T(0), T(1), T(-1), L::min(), L::max(), L::lowest(),
+			T(2)};
+		std::mt19937 g{static_cast<unsigned>(n)};
+		std::vector<T> v(n);
+		for (auto& x : v) {
+			const auto r = g();
+			x = r % 4 == 0 ? special[r / 4 % 7] : T(static_cast<int>(r % 17) - 8);
+		}
+		return v;
+	}
+
+	template<class T>
+	bool same_bits(const T* a, const T* b, std::size_t n) {
+		return n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0;
+	}
+
+	// copy_if agrees with the obvious loop, for each size.
+	template<class T, class Pred>
+	void check_compress(Pred pred) {
+		for (std::size_t n : {0, 1, 7, 8, 9, 33, 255, 256, 257, 1000}) {
+			const auto v = values<T>(n);
+			std::vector<T> expected;
+			for (T x : v) {
+				if (pred(x)) expected.push_back(x);
+			}
+			std::vector<T> out(n, T(3));
+			auto res = ranges::copy_if(v, out.begin(), pred);
+			const auto k = static_cast<std::size_t>(res.out - out.begin());
+			CHECK(res.in == v.end());
+			CHECK(k == expected.size());
+			CHECK(same_bits(out.data(), expected.data(), expected.size()));
+			CHECK(std::all_of(res.out, out.end(), [](T x) { return x == T(3); }));
+
+			// The kernels, called directly: copy_if skips them in constant
+			// evaluation, which is all it can tell without
+			// __builtin_is_constant_evaluated.
+			if constexpr (ranges::detail::__nothrow_compress_predicate<
+				const T&, Pred, ranges::identity>)
+			{
+				ranges::identity proj;
+				std::vector<T> raw(n + 1, T(3));
+				T* t = raw.data();
+				T* none = nullptr;
+				ranges::detail::__compress<const T&, true, false>(v.data(),
+					v.data() + n, t, none, pred, proj);
+				CHECK(t == raw.data() + expected.size());
+				CHECK(same_bits(raw.data(), expected.data(), expected.size()));
+
+				std::vector<T> staged(n, T(3));
+				auto o = staged.begin();
+				int unused = 0;
+				ranges::detail::__compress_copy<const T&, true, false>(v.data(),
+					v.data() + n, o, unused, pred, proj);
+				CHECK(o == staged.begin() + expected.size());
+				CHECK(same_bits(staged.data(), expected.data(), expected.size()));
+			}
+
+			// A pointer output need only have room for the result.
+			std::vector<T> exact(expected.size() + 8, T(3));
+			auto res2 = ranges::copy_if(v, exact.data(), pred);
+			CHECK(res2.out == exact.data() + expected.size());
+			CHECK(same_bits(exact.data(), expected.data(), expected.size()));
+			CHECK(std::all_of(exact.begin() + expected.size(), exact.end(),
+				[](T x) { return x == T(3); }));
+		}
+	}
+
+	template<class T>
+	void check_compress_all() {
+		using ranges::ext::lt, ranges::ext::le, ranges::ext::gt,
+			ranges::ext::ge, ranges::ext::eq, ranges::ext::ne;
+		check_compress<T>(lt(T(0)));
+		check_compress<T>(le(T(1)));
+		check_compress<T>(gt(T(-1)));
+		check_compress<T>(ge(T(0)));
+		check_compress<T>(eq(T(2)));
+		check_compress<T>(ne(T(0)));
+		check_compress<T>(gt(std::numeric_limits<T>::max()));
+		check_compress<T>([](T x) { return x > T(1); });
+		check_compress<T>([](T x) noexcept { return x > T(1); });
+	}
+
+	// Trivially copyable, but not default constructible.
+	struct NoDefault {
+		int x;
+		NoDefault(int i) : x{i} {}
+	};
+}
+
 int main() {
 	static const int source[] = {5,4,3,2,1,0};
 	static constexpr std::ptrdiff_t n = sizeof(source)/sizeof(source[0]);
@@ -104,5 +205,51 @@ int main() {
 		CHECK(std::count(target + n / 2, target + n, -1) == n / 2);
 	}
 
+	{
+		// The branchless and vectorized paths.
+		check_compress_all<int>();
+		check_compress_all<unsigned>();
+		check_compress_all<std::int64_t>();
+		check_compress_all<std::uint64_t>();
+		check_compress_all<float>();
+		check_compress_all<double>();
+		check_compress_all<short>();
+		check_compress_all<unsigned char>();
+	}
+
+	{
+		// A predicate that may throw is called on the elements one at a
+		// time, and the elements it passed are written before it throws.
+		int source[300];
+		for (int i = 0; i < 300; ++i) source[i] = i;
+		std::vector<int> target;
+		int calls = 0;
+		try {
+			ranges::copy_if(source, ranges::back_inserter(target), [&](int x) {
+				++calls;
+				if (x == 100) throw x;
+				return x % 2 == 0;
+			});
+		} catch (int) {}
+		CHECK(calls == 101);
+		CHECK(target.size() == 50u);
+	}
+
+	{
+		std::vector<NoDefault> source;
+		for (int i = 0; i < 600; ++i) source.push_back(NoDefault{i});
+		std::vector<NoDefault> target(600, NoDefault{-1});
+		auto res = ranges::copy_if(source, target.begin(),
+			[](NoDefault p) { return p.x % 3 == 0; });
+		const auto k = res.out - target.begin();
+		CHECK(res.in == source.end());
+		CHECK(k == 200);
+		for (int i = 0; i < 200; ++i) {
+			const int expected = i * 3;
+			CHECK(target[i].x == expected);
+		}
+		CHECK(target[200].x == -1);
+	}
+
 	return test_result();
 }
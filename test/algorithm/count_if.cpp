@@ -10,6 +10,10 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <stl2/detail/algorithm/count_if.hpp>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -24,6 +28,29 @@ struct T
 	bool m() { return b; }
 };
 
+// The vectorized count of the members of an ext::char_set agrees with a
+// plain loop, for every length around a multiple of the vector width.
+template<class C>
+void test_char_set()
+{
+	using namespace __stl2;
+	const ext::char_set set{"\t\n ,;\x80\xff"};
+	auto is_member = [&](C c) { return set.contains(c); };
+	std::mt19937 gen{static_cast<unsigned>(sizeof(C))};
+	std::vector<C> v(300);
+	for (auto& c : v) c = static_cast<C>(gen() % 4 == 0 ? ' ' : gen());
+	for (std::size_t n = 0; n < v.size(); ++n) {
+		CHECK(count_if(v.data(), v.data() + n, set) ==
+			count_if(v.data(), v.data() + n, is_member));
+		// The kernel, called directly: count_if skips it in constant
+		// evaluation, which is all it can tell on compilers without
+		// __builtin_is_constant_evaluated.
+		CHECK(detail::__count_char_set(v.data(), v.data() + n, set) ==
+			count_if(v.data(), v.data() + n, is_member));
+	}
+	CHECK(count_if(v, ref(set)) == count_if(v, is_member));
+}
+
 int main()
 {
 	using namespace __stl2;
@@ -87,5 +114,13 @@ int main()
 		CHECK(count_if(std::move(l), equals(42)) == 0);
 	}
 
+	test_char_set<char>();
+	test_char_set<unsigned char>();
+	test_char_set<std::byte>();
+	{
+		const std::string text = "one, two; three\tfour";
+		CHECK(count_if(text, ext::char_set{" ,;\t"}) == 5);
+	}
+
 	return ::test_result();
 }
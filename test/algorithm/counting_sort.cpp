@@ -0,0 +1,116 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/counting_sort.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	enum class level : std::int8_t { low = -5, mid = 0, high = 100 };
+
+	struct record {
+		std::uint8_t key;
+		std::unique_ptr<int> id;
+	};
+}
+
+int main() {
+	using ranges::ext::counting_sort;
+
+	std::mt19937 gen{42};
+	{
+		// Stable, with move-only elements.
+		std::vector<record> v;
+		for (int i = 0; i < 5000; ++i) {
+			v.push_back(record{static_cast<std::uint8_t>(gen() % 10), std::make_unique<int>(i)});
+		}
+		auto it = counting_sort(v, 10, &record::key);
+		CHECK(it == v.end());
+		for (std::size_t i = 1; i < v.size(); ++i) {
+			CHECK((v[i - 1].key < v[i].key ||
+				(v[i - 1].key == v[i].key && *v[i - 1].id < *v[i].id)));
+		}
+	}
+	{
+		int a[] = {2, 0, 1, 2, 0};
+		counting_sort(a, 3);
+		CHECK_EQUAL(a, {0, 0, 1, 2, 2});
+		int b[] = {7};
+		counting_sort(b, 8);
+		CHECK(b[0] == 7);
+	}
+	{
+		// The projection is called once per element, and keys past 16 bits
+		// are recorded in full.
+		std::vector<std::size_t> v(3000);
+		for (auto& x : v) x = gen() % 100000;
+		auto expected = v;
+		std::sort(expected.begin(), expected.end());
+		int calls = 0;
+		counting_sort(v, 100000, [&calls](std::size_t& x) { ++calls; return x; });
+		CHECK(calls == 3000);
+		CHECK(v == expected);
+	}
+	{
+		// sort counts on 8- and 16-bit keys, ascending and descending; the
+		// counting is stable.
+		std::vector<std::uint8_t> u(10000);
+		for (auto& x : u) x = static_cast<std::uint8_t>(gen());
+		auto eu = u;
+		std::sort(eu.begin(), eu.end());
+		ranges::sort(u);
+		CHECK(u == eu);
+
+		std::vector<std::int16_t> s(200000);
+		for (auto& x : s) x = static_cast<std::int16_t>(gen());
+		auto es = s;
+		std::sort(es.begin(), es.end(), std::greater<>{});
+		ranges::sort(s, ranges::greater{});
+		CHECK(s == es);
+
+		std::vector<level> e(2000);
+		const level levels[] = {level::high, level::low, level::mid};
+		for (auto& x : e) x = levels[gen() % 3];
+		std::vector<std::pair<level, int>> p(e.size());
+		for (int i = 0; i < 2000; ++i) p[i] = {e[i], i};
+		ranges::sort(p, ranges::less{}, &std::pair<level, int>::first);
+		CHECK((std::is_sorted(p.begin(), p.end())));
+	}
+
+	{
+		// The kernel, called directly: sort and stable_sort skip it in
+		// constant evaluation, which is all they can tell on compilers
+		// without __builtin_is_constant_evaluated.
+		std::mt19937 gen{7};
+		for (int n : {0, 1, 2, 100, 5000}) {
+			std::vector<std::pair<int, int>> v(n);
+			for (int i = 0; i < n; ++i) v[i] = {static_cast<int>(gen() % 300), i};
+			auto expected = v;
+			std::stable_sort(expected.begin(), expected.end(),
+				[](const auto& x, const auto& y) { return x.first < y.first; });
+			CHECK(ranges::detail::__counting_sort_n<std::uint16_t>(v.begin(),
+				static_cast<std::ptrdiff_t>(n), 300,
+				[](const std::pair<int, int>& x) {
+					return static_cast<std::size_t>(x.first);
+				}));
+			CHECK(v == expected);
+		}
+	}
+
+	return ::test_result();
+}
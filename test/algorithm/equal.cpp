@@ -19,6 +19,11 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/equal.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -32,6 +37,37 @@ bool counting_equals(const T &a, const T &b) {
 	return a == b;
 }
 
+// The memcmp and vectorized paths agree with the standard library, for
+// ranges that differ at each position and in length.
+template<class T>
+void test_contiguous() {
+	std::mt19937 gen{static_cast<unsigned>(sizeof(T))};
+	for (std::size_t n : {0, 1, 7, 31, 32, 33, 100}) {
+		std::vector<T> a(n);
+		for (auto& x : a) x = static_cast<T>(gen() % 128);
+		const std::vector<T> b = a;
+		CHECK(ranges::equal(a, b));
+		CHECK(ranges::equal(a.data(), a.data() + n, b.data(), b.data() + n));
+		for (std::size_t i = 0; i < n; ++i) {
+			auto c = a;
+			c[i] = static_cast<T>(static_cast<int>(c[i]) + 1);
+			CHECK(!ranges::equal(a, c));
+			CHECK(!ranges::equal(c, a));
+
+			// The kernels, called directly: equal skips them in constant
+			// evaluation, which is all it can tell on compilers without
+			// __builtin_is_constant_evaluated.
+			CHECK(!ranges::detail::__equal_contiguous(a.data(), c.data(), n));
+			CHECK(ranges::detail::__first_difference<false>(a.data(), c.data(), n) == i);
+			CHECK(ranges::detail::__first_difference<false>(a.data(), a.data(), i) == i);
+		}
+		CHECK(ranges::detail::__equal_contiguous(a.data(), b.data(), n));
+		if (n > 0) {
+			CHECK(!ranges::equal(a.data(), a.data() + n, b.data(), b.data() + n - 1));
+		}
+	}
+}
+
 int main() {
 	using namespace ranges;
 
@@ -70,5 +106,21 @@ int main() {
 	test_case(false, 0,     R(ia), R(ia + s), R(ia), R(ia + s - 1));
 	test_case(false, s - 1, R(ia), S(ia + s), R(ia), S(ia + s - 1));
 
+	test_contiguous<unsigned char>();
+	test_contiguous<std::byte>();
+	test_contiguous<char>();
+	test_contiguous<short>();
+	test_contiguous<int>();
+	test_contiguous<std::uint64_t>();
+	test_contiguous<float>();
+	test_contiguous<double>();
+	{
+		// Equality of floating-point values is not that of their bits.
+		const double x[] = {0.0, 1.0, 2.0};
+		const double y[] = {-0.0, 1.0, 2.0};
+		CHECK(ranges::equal(x, y));
+		CHECK(ranges::detail::__equal_contiguous(x, y, 3));
+	}
+
 	return ::test_result();
 }
@@ -0,0 +1,113 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/external_sort.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
+#include <stl2/view/subrange.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+namespace fs = std::filesystem;
+
+namespace {
+	struct record {
+		int key;
+		int payload[3];
+	};
+}
+
+int main() {
+	using ranges::ext::external_sort;
+
+	const fs::path dir = fs::temp_directory_path() /
+		("stl2-external-sort-test-" + std::to_string(std::random_device{}()));
+	fs::create_directory(dir);
+
+	std::mt19937 gen{42};
+	{
+		// 100000 ints in a 64 KiB budget: 13 runs, merged two at a time.
+		std::vector<int> v(100000);
+		for (auto& x : v) x = static_cast<int>(gen() % 50000);
+		std::vector<int> out;
+		auto [in, o] = external_sort(v, ranges::back_inserter(out),
+			ranges::less{}, ranges::identity{}, 64 << 10, dir);
+		CHECK(in == v.end());
+		static_assert(ranges::Same<decltype(o), ranges::back_insert_iterator<std::vector<int>>>);
+		std::sort(v.begin(), v.end());
+		CHECK(out == v);
+		CHECK(fs::is_empty(dir));
+	}
+	{
+		// 256000 ints in a 1 KiB budget: 2000 runs, more than there are file
+		// descriptors to hold them all open.
+		std::vector<int> v(256000);
+		for (auto& x : v) x = static_cast<int>(gen());
+		std::vector<int> out;
+		external_sort(v, ranges::back_inserter(out), ranges::less{},
+			ranges::identity{}, 1 << 10, dir);
+		std::sort(v.begin(), v.end());
+		CHECK(out == v);
+		CHECK(fs::is_empty(dir));
+	}
+	{
+		// Records from an input range, descending by key, through a projection.
+		std::vector<record> v(20000);
+		for (int i = 0; i < 20000; ++i) {
+			v[i] = record{static_cast<int>(gen() % 1000), {i, -i, 2 * i}};
+		}
+		std::vector<record> out(v.size());
+		auto [in, o] = external_sort(
+			::input_iterator<record*>(v.data()), ::sentinel<record*>(v.data() + v.size()),
+			out.data(), ranges::greater{}, &record::key, 512 << 10, dir);
+		CHECK(in.base() == v.data() + v.size());
+		CHECK(o == out.data() + out.size());
+		CHECK(std::is_sorted(out.begin(), out.end(),
+			[](const record& x, const record& y) { return x.key > y.key; }));
+		std::vector<bool> seen(v.size());
+		for (auto& r : out) {
+			CHECK(r.payload[1] == -r.payload[0]);
+			CHECK(r.payload[2] == 2 * r.payload[0]);
+			seen[r.payload[0]] = true;
+		}
+		CHECK(std::count(seen.begin(), seen.end(), true) == 20000);
+		CHECK(fs::is_empty(dir));
+	}
+	{
+		// Input that fits in memory never touches the disk.
+		std::vector<int> v = {3, 1, 2};
+		int out[3];
+		external_sort(v, out, ranges::less{}, ranges::identity{}, 1 << 20,
+			dir / "missing");
+		CHECK_EQUAL(out, {1, 2, 3});
+	}
+	{
+		// Input that does not fit reports a missing temporary directory.
+		std::vector<int> v(1000, 0);
+		std::vector<int> out;
+		bool thrown = false;
+		try {
+			external_sort(v, ranges::back_inserter(out), ranges::less{},
+				ranges::identity{}, 1 << 10, dir / "missing");
+		} catch (const std::system_error&) {
+			thrown = true;
+		}
+		CHECK(thrown);
+	}
+
+	fs::remove_all(dir);
+	return ::test_result();
+}
@@ -27,6 +27,11 @@
 namespace ranges = __stl2;
 #endif
 
+#include <cstddef>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 #include "../test_utils.hpp"
@@ -220,8 +225,47 @@ void test_rng_pred_proj()
 							 input_iterator<const S*>(ia));
 }
 
+// Searches of contiguous characters for any of a set of characters
+// compared by equal_to go by way of an ext::char_set, and find what the
+// nested loop does.
+template<class C>
+void test_char_set()
+{
+	std::mt19937 gen{static_cast<unsigned>(sizeof(C))};
+	const std::vector<C> needles = {C(' '), C('\n'), C(0x80), C(0xff), C(' ')};
+	const std::list<C> listed(needles.begin(), needles.end());
+	for (std::size_t n : {0, 1, 31, 32, 33, 64, 100}) {
+		std::vector<C> v(n);
+		for (auto& c : v) {
+			do c = static_cast<C>(gen());
+			while (ranges::find_first_of(&c, &c + 1, needles.begin(), needles.end(),
+				[](C x, C y) { return x == y; }) != &c + 1);
+		}
+		CHECK(ranges::find_first_of(v, needles) == v.end());
+		for (std::size_t i = 0; i < n; i += 5) {
+			for (C c : needles) {
+				auto w = v;
+				w[i] = c;
+				CHECK(ranges::find_first_of(w, needles) == w.begin() + i);
+				CHECK(ranges::find_first_of(w.data(), w.data() + n,
+					listed.begin(), listed.end()) == w.data() + i);
+			}
+		}
+	}
+	std::vector<C> w(40, C('x'));
+	CHECK(ranges::find_first_of(w, std::vector<C>{}) == w.end());
+}
+
 int main()
 {
+	::test_char_set<char>();
+	::test_char_set<unsigned char>();
+	::test_char_set<std::byte>();
+	{
+		const std::string text = "key = value";
+		const std::string delims = "=:";
+		CHECK(ranges::find_first_of(text, delims) == text.begin() + 4);
+	}
 	::test_iter();
 	::test_iter_pred();
 	::test_rng();
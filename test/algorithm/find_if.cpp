@@ -20,6 +20,10 @@
 
 #include <stl2/detail/algorithm/find_if.hpp>
 #include <stl2/utility.hpp>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -28,6 +32,49 @@ struct S
 	int i_;
 };
 
+// The vectorized search for the members of an ext::char_set finds what a
+// plain loop does, at every position and for every byte value.
+template<class C>
+void test_char_set()
+{
+	using namespace __stl2;
+	const ext::char_set set{"\t\n ,;\x80\xff"};
+	auto is_member = [&](C c) { return set.contains(c); };
+	std::mt19937 gen{static_cast<unsigned>(sizeof(C))};
+	for (std::size_t n : {0, 1, 31, 32, 33, 64, 100, 1000}) {
+		std::vector<C> v(n);
+		for (auto& c : v) {
+			do c = static_cast<C>(gen()); while (set.contains(c));
+		}
+		CHECK(find_if(v, set) == v.end());
+		CHECK(detail::__find_char_set(v.data(), v.data() + n, set) == v.data() + n);
+		for (std::size_t i = 0; i < n; i += 7) {
+			for (int c : {int{'\t'}, int{' '}, 0x80, 0xff}) {
+				auto w = v;
+				w[i] = static_cast<C>(c);
+				CHECK(find_if(w, set) == w.begin() + i);
+				CHECK(find_if(w.data(), w.data() + n, ref(set)) == w.data() + i);
+				CHECK(find_if(w, is_member) == w.begin() + i);
+				// The kernel, called directly: find_if skips it in
+				// constant evaluation, which is all it can tell on
+				// compilers without __builtin_is_constant_evaluated.
+				CHECK(detail::__find_char_set(w.data(), w.data() + n, set) ==
+					w.data() + i);
+			}
+		}
+	}
+	// Every byte value is tested against the table.
+	std::vector<C> all(256);
+	for (int c = 0; c < 256; ++c) all[c] = static_cast<C>(c);
+	for (int c = 0; c < 256; ++c) {
+		ext::char_set one;
+		one.insert(static_cast<unsigned char>(c));
+		CHECK(find_if(all, one) == all.begin() + c);
+		CHECK(detail::__find_char_set(all.data(), all.data() + 256, one) ==
+			all.data() + c);
+	}
+}
+
 int main()
 {
 	using namespace __stl2;
@@ -68,5 +115,14 @@ int main()
 	ps = find_if(sa, [](int i){return i == 10;}, &S::i_);
 	CHECK(ps == end(sa));
 
+	test_char_set<char>();
+	test_char_set<signed char>();
+	test_char_set<unsigned char>();
+	test_char_set<std::byte>();
+	{
+		const std::string text = "find the first vowel";
+		CHECK(find_if(text, ext::char_set{"aeiou"}) == text.begin() + 1);
+	}
+
 	return ::test_result();
 }
@@ -0,0 +1,90 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/hash_difference.hpp>
+#include <stl2/detail/algorithm/set_difference.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
+#include <forward_list>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct S {
+		int key;
+		int payload;
+	};
+}
+
+int main() {
+	{
+		int a[] = {4, 1, 2, 2, 2, 3};
+		int b[] = {2, 5, 2, 4};
+		int out[6];
+		auto r = ranges::ext::hash_difference(a, b, out);
+		CHECK(r.in == a + 6);
+		// the last occurrences of a key are the ones left over
+		CHECK_EQUAL(ranges::subrange(out, r.out), {1, 2, 3});
+	}
+	{
+		// heterogeneous keys; the second range is forward-only
+		S a[] = {{1, 0}, {2, 1}, {3, 2}, {2, 3}};
+		std::forward_list<int> b = {2, 3, 7};
+		std::vector<S> outs;
+		ranges::ext::hash_difference(a, b, ranges::back_inserter(outs),
+			&S::key);
+		CHECK(outs.size() == 2u);
+		CHECK(outs[0].payload == 0);
+		CHECK(outs[1].payload == 3);
+	}
+	{
+		std::string a[] = {"a", "b", "c"};
+		std::vector<std::string> b = {};
+		std::vector<std::string> out;
+		ranges::ext::hash_difference(a, b, ranges::back_inserter(out));
+		CHECK_EQUAL(out, {"a", "b", "c"});
+	}
+	{
+		// mixed key types: the first range's keys are hashed as the second's
+		double a[] = {2.0, 2.5, 3.0};
+		std::vector<int> b = {2, 3};
+		std::vector<double> out;
+		ranges::ext::hash_difference(a, b, ranges::back_inserter(out));
+		CHECK_EQUAL(out, {2.5});
+
+		const char* c[] = {"x", "y", "z"};
+		std::vector<std::string> d = {"z", "x"};
+		std::vector<const char*> outc;
+		ranges::ext::hash_difference(c, d, ranges::back_inserter(outc));
+		CHECK(outc.size() == 1u);
+		CHECK(outc[0] == c[1]);
+	}
+	{
+		// agrees with set_difference on sorted input
+		std::mt19937 gen;
+		std::uniform_int_distribution<int> dist{0, 99};
+		std::vector<int> a(1000), b(500);
+		for (auto& i : a) i = dist(gen);
+		for (auto& i : b) i = dist(gen);
+		std::vector<int> expected, result;
+		std::vector<int> sa = a, sb = b;
+		ranges::sort(sa);
+		ranges::sort(sb);
+		ranges::set_difference(sa, sb, ranges::back_inserter(expected));
+		ranges::ext::hash_difference(a, b, ranges::back_inserter(result));
+		ranges::sort(result);
+		CHECK(result == expected);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,87 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/hash_unique.hpp>
+#include <forward_list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct S {
+		int key;
+		int payload;
+	};
+}
+
+int main() {
+	{
+		int a[] = {3, 1, 3, 2, 1, 4, 2, 3};
+		auto e = ranges::ext::hash_unique(a);
+		CHECK(ranges::distance(a, e) == 4);
+		CHECK_EQUAL(ranges::subrange(a, e), {3, 1, 2, 4});
+	}
+	{
+		int a[] = {0};
+		CHECK(ranges::ext::hash_unique(a, a) == a);
+		CHECK(ranges::ext::hash_unique(a) == a + 1);
+	}
+	{
+		// non-sized, forward-only
+		std::forward_list<std::string> l = {"b", "a", "b", "c", "a"};
+		auto e = ranges::ext::hash_unique(l);
+		l.erase_after(std::next(l.before_begin(), ranges::distance(l.begin(), e)),
+			l.end());
+		CHECK_EQUAL(l, {"b", "a", "c"});
+	}
+	{
+		// projection; the first occurrence of each key is kept
+		S a[] = {{1, 0}, {2, 1}, {1, 2}, {3, 3}, {2, 4}};
+		auto e = ranges::ext::hash_unique(a, &S::key);
+		CHECK(ranges::distance(a, e) == 3);
+		CHECK(a[0].payload == 0);
+		CHECK(a[1].payload == 1);
+		CHECK(a[2].payload == 3);
+	}
+	{
+		// move-only
+		std::unique_ptr<int> a[5];
+		int v[] = {1, 2, 1, 3, 2};
+		for (int i = 0; i < 5; ++i) a[i] = std::make_unique<int>(v[i]);
+		auto deref = [](const std::unique_ptr<int>& p) { return *p; };
+		auto e = ranges::ext::hash_unique(a, deref);
+		CHECK(ranges::distance(a, e) == 3);
+		CHECK(*a[0] == 1);
+		CHECK(*a[1] == 2);
+		CHECK(*a[2] == 3);
+	}
+	{
+		std::mt19937 gen;
+		std::uniform_int_distribution<int> dist{0, 999};
+		std::vector<int> v(10000);
+		for (auto& i : v) i = dist(gen);
+		std::vector<int> expected;
+		std::vector<bool> seen(1000);
+		for (auto i : v) {
+			if (!seen[i]) {
+				seen[i] = true;
+				expected.push_back(i);
+			}
+		}
+		auto e = ranges::ext::hash_unique(v.begin(), v.end());
+		v.erase(e, v.end());
+		CHECK(v == expected);
+	}
+
+	return ::test_result();
+}
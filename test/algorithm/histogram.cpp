@@ -0,0 +1,65 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/histogram.hpp>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	enum class color : unsigned char { red, green, blue };
+}
+
+int main() {
+	using ranges::ext::histogram;
+
+	{
+		std::vector<std::uint8_t> v(100000);
+		std::mt19937 gen{42};
+		for (auto& x : v) x = static_cast<std::uint8_t>(gen() % 200);
+		std::vector<std::ptrdiff_t> expected(256);
+		for (auto x : v) ++expected[x];
+		auto h = histogram(v, 256);
+		static_assert(ranges::Same<decltype(h), std::vector<std::ptrdiff_t>>);
+		CHECK(h == expected);
+	}
+	{
+		// Short input and long runs of one key.
+		int a[] = {3, 3, 3, 3, 3, 1, 0, 3, 3};
+		CHECK_EQUAL(histogram(a, 4), {1, 1, 0, 7});
+		CHECK_EQUAL(histogram(a, 4, [](int x) { return 3 - x; }), {7, 0, 1, 1});
+		std::vector<int> many(10000, 2);
+		auto h = histogram(many, 3);
+		CHECK_EQUAL(h, {0, 0, 10000});
+	}
+	{
+		// Single pass input of enumerators, through a projection.
+		std::vector<std::pair<color, std::string>> v;
+		for (int i = 0; i < 3000; ++i) {
+			v.emplace_back(static_cast<color>(i % 3 == 2 ? 0 : i % 3), std::to_string(i));
+		}
+		auto h = histogram(
+			::input_iterator<std::pair<color, std::string>*>(v.data()),
+			::sentinel<std::pair<color, std::string>*>(v.data() + v.size()),
+			3, &std::pair<color, std::string>::first);
+		CHECK_EQUAL(h, {2000, 1000, 0});
+	}
+	{
+		std::vector<int> v;
+		CHECK_EQUAL(histogram(v, 2), {0, 0});
+		CHECK(histogram(v, 0).empty());
+	}
+
+	return ::test_result();
+}
@@ -24,6 +24,10 @@
 
 #include <stl2/detail/algorithm/is_permutation.hpp>
 #include <stl2/utility.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -65,6 +69,45 @@ struct T {
 	int i;
 };
 
+// Totally ordered, but not hashable.
+struct Ordered {
+	int i;
+
+	friend bool operator==(Ordered x, Ordered y) { return x.i == y.i; }
+	friend bool operator!=(Ordered x, Ordered y) { return !(x == y); }
+	friend bool operator<(Ordered x, Ordered y) { return x.i < y.i; }
+	friend bool operator>(Ordered x, Ordered y) { return y < x; }
+	friend bool operator<=(Ordered x, Ordered y) { return !(y < x); }
+	friend bool operator>=(Ordered x, Ordered y) { return !(x < y); }
+};
+
+// Exercise the by-value strategies, which only apply to long sequences.
+template<class V, class F>
+void test_by_value(F make) {
+	std::vector<V> a;
+	for (int i = 0; i < 1000; ++i) {
+		a.push_back(make(i % 100));
+	}
+	auto b = a;
+	std::shuffle(b.begin(), b.end(), std::mt19937{});
+	using I = forward_iterator<const V*>;
+	CHECK(ranges::is_permutation(a, b));
+	CHECK(ranges::is_permutation(
+		I{a.data()}, I{a.data() + a.size()}, I{b.data()}, I{b.data() + b.size()}));
+
+	// same multiset of keys, different multiplicities
+	auto c = b;
+	*std::find(c.begin(), c.end(), make(0)) = make(1);
+	CHECK(!ranges::is_permutation(a, c));
+	CHECK(!ranges::is_permutation(c, a));
+
+	// value not present in the other sequence
+	c = b;
+	c.back() = make(-1);
+	CHECK(!ranges::is_permutation(a, c));
+	CHECK(!ranges::is_permutation(c, a));
+}
+
 int main() {
 	{
 		const int ia[] = {0};
@@ -331,5 +374,22 @@ int main() {
 		test(true, a, a + 4, b, b + 4);
 	}
 
+	test_by_value<int>([](int i) { return i; });
+	test_by_value<std::string>([](int i) { return std::to_string(i); });
+	test_by_value<Ordered>([](int i) { return Ordered{i}; });
+
+	{
+		// by-value comparison through projections
+		std::vector<S> a;
+		std::vector<T> b;
+		for (int i = 0; i < 100; ++i) {
+			a.push_back(S{i});
+			b.push_back(T{99 - i});
+		}
+		CHECK(ranges::is_permutation(a, b, ranges::equal_to{}, &S::i, &T::i));
+		b[0].i = 42;
+		CHECK(!ranges::is_permutation(a, b, ranges::equal_to{}, &S::i, &T::i));
+	}
+
 	return ::test_result();
 }
@@ -19,6 +19,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/lexicographical_compare.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -160,9 +166,77 @@ void test_iter_comp() {
 	test_iter_comp1<const int*, const int*>();
 }
 
+// The memcmp and vectorized paths agree with the standard library, for
+// ranges that differ at each position, in either direction, and in
+// length.
+template<class T>
+void test_contiguous() {
+	const T lo = std::numeric_limits<T>::lowest();
+	const T hi = std::numeric_limits<T>::max();
+	std::mt19937 gen{static_cast<unsigned>(sizeof(T))};
+	for (std::size_t n : {0, 1, 7, 31, 32, 33, 100}) {
+		std::vector<T> a(n);
+		for (auto& x : a) x = static_cast<T>(gen() % 100);
+		for (std::size_t i = 0; i <= n; ++i) {
+			for (T v : {lo, hi, T(50)}) {
+				auto b = a;
+				if (i < n) b[i] = v;
+				else b.push_back(v);
+				CHECK(ranges::lexicographical_compare(a, b) ==
+					std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
+				CHECK(ranges::lexicographical_compare(b, a) ==
+					std::lexicographical_compare(b.begin(), b.end(), a.begin(), a.end()));
+				CHECK(!ranges::lexicographical_compare(b, b));
+
+				// The kernel, called directly: lexicographical_compare skips
+				// it in constant evaluation, which is all it can tell on
+				// compilers without __builtin_is_constant_evaluated.
+				using ranges::detail::__lexicographical_compare_contiguous;
+				CHECK(__lexicographical_compare_contiguous(a.data(), a.size(),
+					b.data(), b.size()) ==
+					std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
+				CHECK(__lexicographical_compare_contiguous(b.data(), b.size(),
+					a.data(), a.size()) ==
+					std::lexicographical_compare(b.begin(), b.end(), a.begin(), a.end()));
+			}
+		}
+	}
+}
+
+void test_bytes() {
+	const std::byte a[] = {std::byte{1}, std::byte{0x80}, std::byte{3}};
+	const std::byte b[] = {std::byte{1}, std::byte{0x7f}, std::byte{4}};
+	CHECK(ranges::lexicographical_compare(b, a));
+	CHECK(!ranges::lexicographical_compare(a, b));
+	CHECK(ranges::lexicographical_compare(a, a + 2, a, a + 3));
+
+	// Signed bytes are not memcmp-ordered.
+	const signed char c[] = {1, -1};
+	const signed char d[] = {1, 1};
+	CHECK(ranges::lexicographical_compare(c, d));
+	CHECK(!ranges::lexicographical_compare(d, c));
+
+	// Nor are floating-point values.
+	const double x[] = {-0.0, -1.0};
+	const double y[] = {0.0, 1.0};
+	CHECK(ranges::lexicographical_compare(x, y));
+	CHECK(!ranges::lexicographical_compare(y, x));
+}
+
 int main() {
 	test_iter();
 	test_iter_comp();
 
+	test_contiguous<unsigned char>();
+	test_contiguous<char>();
+	test_contiguous<signed char>();
+	test_contiguous<unsigned short>();
+	test_contiguous<int>();
+	test_contiguous<std::uint32_t>();
+	test_contiguous<std::int64_t>();
+	test_contiguous<float>();
+	test_contiguous<double>();
+	test_bytes();
+
 	return test_result();
 }
@@ -0,0 +1,105 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/merge_k.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
+#include <stl2/view/subrange.hpp>
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using ranges::ext::merge_k;
+
+	{
+		std::vector<std::vector<int>> runs = {{1, 4, 7}, {}, {2, 5, 8}, {0, 3, 6, 9}};
+		std::vector<int> out;
+		auto o = merge_k(runs, ranges::back_inserter(out));
+		static_assert(ranges::Same<decltype(o), ranges::back_insert_iterator<std::vector<int>>>);
+		CHECK_EQUAL(out, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+	}
+	{
+		// Runs of a non-random-access kind, descending, with a projection;
+		// ties keep the order of the runs.
+		using P = std::pair<int, int>;
+		std::list<std::forward_list<P>> runs = {
+			{{5, 0}, {3, 0}, {3, 1}},
+			{{5, 1}, {4, 0}},
+			{{3, 2}, {1, 0}},
+		};
+		P out[7];
+		auto o = merge_k(runs, out, ranges::greater{}, &P::first);
+		CHECK(o == out + 7);
+		P expected[] = {{5, 0}, {5, 1}, {4, 0}, {3, 0}, {3, 1}, {3, 2}, {1, 0}};
+		CHECK(ranges::equal(out, expected));
+	}
+	{
+		// Runs given as subranges of one array
+		int a[] = {1, 3, 5, 2, 4, 6};
+		ranges::subrange<int*> runs[] = {{a, a + 3}, {a + 3, a + 6}};
+		int out[6];
+		merge_k(runs, out);
+		CHECK_EQUAL(out, {1, 2, 3, 4, 5, 6});
+	}
+	{
+		std::vector<std::vector<int>> runs;
+		int out[1] = {42};
+		CHECK(merge_k(runs, out) == out);
+		CHECK(out[0] == 42);
+		runs.emplace_back();
+		CHECK(merge_k(runs, out) == out);
+	}
+	{
+		// Many runs agree with a stable sort of their concatenation.
+		std::mt19937 gen;
+		std::uniform_int_distribution<int> dist{0, 1000};
+		for (std::size_t k : {1u, 2u, 3u, 7u, 64u, 257u}) {
+			std::vector<std::vector<std::pair<int, std::size_t>>> runs(k);
+			std::vector<std::pair<int, std::size_t>> all;
+			for (std::size_t i = 0; i < k; ++i) {
+				std::vector<int> keys(dist(gen) % 50);
+				for (auto& x : keys) x = dist(gen);
+				std::sort(keys.begin(), keys.end());
+				for (int x : keys) runs[i].emplace_back(x, i);
+				all.insert(all.end(), runs[i].begin(), runs[i].end());
+			}
+			std::stable_sort(all.begin(), all.end(),
+				[](auto& x, auto& y) { return x.first < y.first; });
+			std::vector<std::pair<int, std::size_t>> out;
+			merge_k(runs, ranges::back_inserter(out), ranges::less{},
+				&std::pair<int, std::size_t>::first);
+			CHECK(out == all);
+		}
+	}
+	{
+		// Runs that run out cost no more than the elements they held.
+		constexpr int k = 4096;
+		std::vector<std::vector<int>> runs(k);
+		for (int i = 0; i < k; ++i) runs[i] = {i % 97, i % 97 + 100};
+		long comparisons = 0;
+		std::vector<int> out;
+		merge_k(runs, ranges::back_inserter(out), [&comparisons](int x, int y) {
+			++comparisons;
+			return x < y;
+		});
+		CHECK(out.size() == 2u * k);
+		CHECK(std::is_sorted(out.begin(), out.end()));
+		CHECK(comparisons < 2 * 13 * 2 * k + 2 * k);
+	}
+
+	return ::test_result();
+}
@@ -19,10 +19,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/min_element.hpp>
+#include <limits>
 #include <memory>
 #include <random>
 #include <numeric>
 #include <algorithm>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -146,6 +148,26 @@ struct S
 	int i;
 };
 
+// The vectorized path agrees with the standard library, ties and all.
+template<class T>
+void test_simd()
+{
+	for (std::size_t n : {1, 2, 31, 32, 33, 1000, 8191, 8192, 8193, 20000, 40000}) {
+		std::vector<T> v(n);
+		std::uniform_int_distribution<int> dist{-4, 4};
+		for (auto& x : v) x = static_cast<T>(dist(gen));
+		for (std::size_t i : {std::size_t{0}, n / 2, n - 1}) {
+			auto w = v;
+			w[i] = std::numeric_limits<T>::lowest();
+			w[n - 1 - i] = std::numeric_limits<T>::max();
+			CHECK(stl2::min_element(w) == std::min_element(w.begin(), w.end()));
+		}
+		CHECK(stl2::min_element(v) == std::min_element(v.begin(), v.end()));
+		CHECK(stl2::min_element(v.data(), v.data() + n) ==
+			std::min_element(v.data(), v.data() + n));
+	}
+}
+
 int main()
 {
 	test_iter<forward_iterator<const int*> >();
@@ -169,5 +191,16 @@ int main()
 	S const *ps = stl2::min_element(s, std::less<int>{}, &S::i);
 	CHECK(ps->i == -4);
 
+	test_simd<signed char>();
+	test_simd<unsigned char>();
+	test_simd<short>();
+	test_simd<unsigned short>();
+	test_simd<int>();
+	test_simd<unsigned>();
+	test_simd<long long>();
+	test_simd<unsigned long long>();
+	test_simd<float>();
+	test_simd<double>();
+
 	return test_result();
 }
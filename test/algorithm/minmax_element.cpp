@@ -19,10 +19,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/minmax_element.hpp>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <random>
 #include <algorithm>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -171,6 +173,54 @@ struct S {
 	int i;
 };
 
+#if defined(__AVX2__)
+// The kernel, called directly: minmax_element skips it in constant
+// evaluation, which is all it can tell on compilers without
+// __builtin_is_constant_evaluated.
+template<class T>
+void check_kernel(const std::vector<T>& v) {
+	using ranges::detail::__simd_extremum_positions;
+	const T* const first = v.data();
+	const T* const last = first + v.size();
+	const auto expected = std::minmax_element(first, last);
+	const auto both = __simd_extremum_positions<true, true, true>(first, last);
+	CHECK(both.min == expected.first);
+	CHECK(both.max == expected.second);
+	CHECK((__simd_extremum_positions<true, false, false>(first, last).min ==
+		std::min_element(first, last)));
+	CHECK((__simd_extremum_positions<false, true, false>(first, last).max ==
+		std::max_element(first, last)));
+}
+#else
+template<class T>
+void check_kernel(const std::vector<T>&) {}
+#endif
+
+// The vectorized path agrees with the standard library, ties and all.
+template<class T>
+void test_simd() {
+	for (std::size_t n : {1, 2, 31, 32, 33, 1000, 8191, 8192, 8193, 20000, 40000}) {
+		std::vector<T> v(n);
+		std::uniform_int_distribution<int> dist{-4, 4};
+		for (auto& x : v) x = static_cast<T>(dist(gen));
+		for (std::size_t i : {std::size_t{0}, n / 2, n - 1}) {
+			auto w = v;
+			w[i] = std::numeric_limits<T>::lowest();
+			w[n - 1 - i] = std::numeric_limits<T>::max();
+			auto [lo, hi] = ranges::minmax_element(w);
+			auto expected = std::minmax_element(w.begin(), w.end());
+			CHECK(lo == expected.first);
+			CHECK(hi == expected.second);
+			check_kernel(w);
+		}
+		check_kernel(v);
+		auto [lo, hi] = ranges::minmax_element(v);
+		auto expected = std::minmax_element(v.begin(), v.end());
+		CHECK(lo == expected.first);
+		CHECK(hi == expected.second);
+	}
+}
+
 int main() {
 	test_iter<forward_iterator<const int*> >();
 	test_iter<bidirectional_iterator<const int*> >();
@@ -195,5 +245,16 @@ int main() {
 	CHECK(ps.min->i == -4);
 	CHECK(ps.max->i == 40);
 
+	test_simd<signed char>();
+	test_simd<unsigned char>();
+	test_simd<short>();
+	test_simd<unsigned short>();
+	test_simd<int>();
+	test_simd<unsigned>();
+	test_simd<long long>();
+	test_simd<unsigned long long>();
+	test_simd<float>();
+	test_simd<double>();
+
 	return test_result();
 }
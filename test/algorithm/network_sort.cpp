@@ -0,0 +1,113 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/network_sort.hpp>
+#include <stl2/detail/algorithm/nth_element.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	std::mt19937 gen{42};
+
+	// Small networks sort every sequence of zeroes and ones, which by the
+	// 0-1 principle means they sort everything; larger ones are checked on
+	// random permutations.
+	template<std::size_t N>
+	bool sorts() {
+		std::array<int, N> a;
+		if constexpr (N <= 16) {
+			for (unsigned long bits = 0; bits < (1ul << N); ++bits) {
+				for (std::size_t i = 0; i < N; ++i) a[i] = (bits >> i) & 1;
+				if (ranges::ext::network_sort(a) != a.end()) return false;
+				if (!std::is_sorted(a.begin(), a.end())) return false;
+			}
+		} else {
+			for (std::size_t i = 0; i < N; ++i) a[i] = static_cast<int>(i);
+			for (int trial = 0; trial < 200; ++trial) {
+				std::shuffle(a.begin(), a.end(), gen);
+				ranges::ext::network_sort(a);
+				if (!std::is_sorted(a.begin(), a.end())) return false;
+			}
+		}
+		return true;
+	}
+
+	template<std::size_t... Ns>
+	bool all_sort(std::index_sequence<Ns...>) {
+		return (sorts<Ns>() && ...);
+	}
+
+	constexpr bool sorts_at_compile_time() {
+		int a[] = {5, 3, 4, 0, 2, 1};
+		ranges::ext::network_sort(a);
+		for (int i = 0; i < 6; ++i) {
+			if (a[i] != i) return false;
+		}
+		return true;
+	}
+}
+
+int main() {
+	using ranges::ext::network_sort;
+
+	CHECK(all_sort(std::make_index_sequence<33>{}));
+	static_assert(sorts_at_compile_time());
+
+	{
+		int a[] = {4, 1, 3, 2, 0};
+		network_sort(a, ranges::greater{});
+		CHECK_EQUAL(a, {4, 3, 2, 1, 0});
+
+		std::vector<int> v = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+		ranges::ext::span<int, 4> s{v.data() + 3, 4};
+		network_sort(s);
+		CHECK_EQUAL(v, {9, 8, 7, 3, 4, 5, 6, 2, 1, 0});
+	}
+	{
+		// Elements that are not trivially copyable, through a projection.
+		std::array<std::pair<int, std::string>, 7> a;
+		for (int i = 0; i < 7; ++i) a[i] = {(i * 5) % 7, std::to_string(i)};
+		network_sort(a, ranges::less{}, &std::pair<int, std::string>::first);
+		for (int i = 0; i < 7; ++i) {
+			CHECK(a[i].first == i);
+			CHECK((std::stoi(a[i].second) * 5 % 7) == i);
+		}
+	}
+	{
+		// Beyond 32 elements, sort.
+		std::array<int, 100> a;
+		for (int i = 0; i < 100; ++i) a[i] = (i * 37) % 100;
+		CHECK(network_sort(a) == a.end());
+		CHECK(std::is_sorted(a.begin(), a.end()));
+	}
+	{
+		// Small partitions of sort and nth_element.
+		for (int n = 0; n < 40; ++n) {
+			std::vector<double> v(n);
+			for (auto& x : v) x = std::uniform_real_distribution<>{}(gen);
+			auto w = v;
+			std::sort(w.begin(), w.end());
+			for (int k = 0; k < n; ++k) {
+				auto u = v;
+				ranges::nth_element(u, u.begin() + k);
+				CHECK(u[k] == w[k]);
+			}
+		}
+	}
+
+	return ::test_result();
+}
@@ -24,6 +24,11 @@
 
 #include <stl2/detail/algorithm/partition_copy.hpp>
 #include <stl2/iterator.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -120,6 +125,72 @@ void test_rvalue() {
 	CHECK(r2[3].i == 8);
 }
 
+// The branchless and vectorized paths agree with the obvious loop.
+template<class T, class Pred>
+void test_compress(Pred pred) {
+	using L = std::numeric_limits<T>;
+	const T special[] = {T(0), T(1), L::min(), L::max(), L::lowest()};
+	std::mt19937 g{42};
+	for (std::size_t n : {0, 3, 8, 31, 256, 1000}) {
+		std::vector<T> v(n);
+		for (auto& x : v) {
+			const auto r = g();
+			x = r % 4 == 0 ? special[r / 4 % 5] : T(static_cast<int>(r % 9) - 4);
+		}
+		std::vector<T> yes, no;
+		for (T x : v) (pred(x) ? yes : no).push_back(x);
+		std::vector<T> r1(n), r2(n);
+		auto p = ranges::partition_copy(v, r1.begin(), r2.begin(), pred);
+		CHECK(p.in == v.end());
+		r1.erase(p.out1, r1.end());
+		r2.erase(p.out2, r2.end());
+		CHECK(r1 == yes);
+		CHECK(r2 == no);
+
+		// Pointer outputs need only have room for the result.
+		std::vector<T> t(yes.size() + 8, T(7)), f(no.size() + 8, T(7));
+		auto q = ranges::partition_copy(v, t.data(), f.data(), pred);
+		CHECK(q.out1 == t.data() + yes.size());
+		CHECK(q.out2 == f.data() + no.size());
+		CHECK(std::equal(yes.begin(), yes.end(), t.begin()));
+		CHECK(std::equal(no.begin(), no.end(), f.begin()));
+		CHECK(std::all_of(q.out1, t.data() + t.size(), [](T x) { return x == T(7); }));
+		CHECK(std::all_of(q.out2, f.data() + f.size(), [](T x) { return x == T(7); }));
+	}
+}
+
+template<class T>
+void test_compress() {
+	test_compress<T>(ranges::ext::lt(T(0)));
+	test_compress<T>(ranges::ext::ge(T(1)));
+	test_compress<T>(ranges::ext::eq(T(-2)));
+	test_compress<T>(ranges::ext::ne(std::numeric_limits<T>::max()));
+	test_compress<T>([](T x) { return x > T(2); });
+	test_compress<T>([](T x) noexcept { return x > T(2); });
+}
+
+// Trivially copyable, but not default constructible.
+struct NoDefault {
+	int x;
+	NoDefault(int i) : x{i} {}
+	bool operator==(const NoDefault& that) const { return x == that.x; }
+};
+
+void test_no_default() {
+	std::vector<NoDefault> v;
+	for (int i = 0; i < 1000; ++i) v.push_back(NoDefault{i * 7 % 13});
+	auto pred = [](const NoDefault& p) { return p.x < 5; };
+	std::vector<NoDefault> yes, no;
+	for (const auto& p : v) (pred(p) ? yes : no).push_back(p);
+	std::vector<NoDefault> r1(v.size(), NoDefault{-1}), r2(v.size(), NoDefault{-1});
+	auto p = ranges::partition_copy(v, r1.begin(), r2.begin(), pred);
+	CHECK(p.in == v.end());
+	r1.erase(p.out1, r1.end());
+	r2.erase(p.out2, r2.end());
+	CHECK(r1 == yes);
+	CHECK(r2 == no);
+}
+
 int main() {
 	test_iter<input_iterator<const int*> >();
 	test_iter<input_iterator<const int*>, sentinel<const int*>>();
@@ -130,5 +201,14 @@ int main() {
 	test_proj();
 	test_rvalue();
 
+	test_compress<int>();
+	test_compress<unsigned>();
+	test_compress<std::int64_t>();
+	test_compress<std::uint64_t>();
+	test_compress<float>();
+	test_compress<double>();
+	test_compress<std::int16_t>();
+	test_no_default();
+
 	return ::test_result();
 }
@@ -23,9 +23,13 @@
 //===----------------------------------------------------------------------===//
 
 #include <stl2/detail/algorithm/remove_if.hpp>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <random>
 #include <utility>
+#include <vector>
 #include <functional>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -127,6 +131,40 @@ struct S
 	int i;
 };
 
+// The branchless and vectorized paths agree with the obvious loop.
+template<class T, class Pred>
+void test_compress(Pred pred)
+{
+	using L = std::numeric_limits<T>;
+	const T special[] = {T(0), T(1), L::min(), L::max(), L::lowest()};
+	std::mt19937 g{42};
+	for (std::size_t n : {0, 3, 8, 31, 256, 1000}) {
+		std::vector<T> v(n);
+		for (auto& x : v) {
+			const auto r = g();
+			x = r % 4 == 0 ? special[r / 4 % 5] : T(static_cast<int>(r % 9) - 4);
+		}
+		std::vector<T> kept;
+		for (T x : v) {
+			if (!pred(x)) kept.push_back(x);
+		}
+		auto r = ranges::remove_if(v, pred);
+		v.erase(r, v.end());
+		CHECK(v == kept);
+	}
+}
+
+template<class T>
+void test_compress()
+{
+	test_compress<T>(ranges::ext::lt(T(0)));
+	test_compress<T>(ranges::ext::le(T(-1)));
+	test_compress<T>(ranges::ext::gt(T(1)));
+	test_compress<T>(ranges::ext::eq(T(0)));
+	test_compress<T>(ranges::ext::ne(std::numeric_limits<T>::lowest()));
+	test_compress<T>([](T x) { return x < T(3); });
+}
+
 int main()
 {
 	test_iter<forward_iterator<int*> >();
@@ -190,5 +228,13 @@ int main()
 		CHECK(ia[5].i == 4);
 	}
 
+	test_compress<int>();
+	test_compress<unsigned>();
+	test_compress<std::int64_t>();
+	test_compress<std::uint64_t>();
+	test_compress<float>();
+	test_compress<double>();
+	test_compress<char>();
+
 	return ::test_result();
 }
@@ -25,9 +25,15 @@
 
 #include <stl2/detail/algorithm/sample.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <numeric>
+#include <vector>
 #include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/view/subrange.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -275,5 +281,113 @@ int main() {
 		}
 	}
 
+	{
+		// Each k-subset is drawn about equally often, whether the skips come
+		// from Algorithm D (N > 13k), Algorithm A, or the reservoir.
+		auto subsets = [](int N, int k, auto draw) {
+			std::map<std::vector<int>, int> counts;
+			std::vector<int> population(N), out(k);
+			std::iota(population.begin(), population.end(), 0);
+			double subsets = 1;
+			for (int i = 0; i < k; ++i) subsets = subsets * (N - i) / (i + 1);
+			const int per_subset = 200;
+			for (int t = 0; t < per_subset * subsets; ++t) {
+				draw(population, out);
+				std::sort(out.begin(), out.end());
+				CHECK(std::adjacent_find(out.begin(), out.end()) == out.end());
+				++counts[out];
+			}
+			CHECK(counts.size() == subsets);
+			double chi2 = 0;
+			for (auto& [subset, count] : counts) {
+				(void)subset;
+				chi2 += double(count - per_subset) * (count - per_subset) / per_subset;
+			}
+			CHECK((chi2 / (subsets - 1)) < 1.5);
+		};
+		ranges::ext::xoshiro256pp g;
+		auto sized = [&](auto& in, auto& out) {
+			auto result = ranges::ext::sample(in, out, g);
+			CHECK(result.out == out.end());
+			CHECK(std::is_sorted(out.begin(), out.end()));
+		};
+		auto unsized = [&](auto& in, auto& out) {
+			auto result = ranges::ext::sample(input_iterator<int*>(in.data()),
+				sentinel<int*>(in.data() + in.size()), out.begin(),
+				ranges::distance(out), g);
+			CHECK(result.out == out.end());
+		};
+		subsets(100, 2, sized);
+		subsets(10, 3, sized);
+		subsets(10, 3, unsized);
+		subsets(12, 5, unsized);
+	}
+
+	{
+		// Algorithm D hands over to Algorithm A once N <= 13n, which
+		// happens partway through when N / n starts a little above 13.
+		// Each element is selected with probability k / N either way.
+		ranges::ext::xoshiro256pp g;
+		auto inclusion = [&](int N, int k) {
+			std::vector<int> population(N), out(k), counts(N);
+			std::iota(population.begin(), population.end(), 0);
+			const int trials = 4000;
+			for (int t = 0; t < trials; ++t) {
+				auto result = ranges::ext::sample(population, out, g);
+				CHECK(result.out == out.end());
+				CHECK(std::adjacent_find(out.begin(), out.end(),
+					std::greater_equal<>{}) == out.end());
+				for (int x : out) ++counts[x];
+			}
+			const double expected = double(trials) * k / N;
+			double chi2 = 0;
+			for (int c : counts) chi2 += (c - expected) * (c - expected) / expected;
+			const double per_degree = chi2 / (N - 1);
+			CHECK(per_degree < 1.25);
+		};
+		inclusion(1000, 50);
+		inclusion(1000, 70);
+		inclusion(1000, 75);
+	}
+
+	{
+		// Populations no larger than the sample are copied whole.
+		int data[] = {0,1,2};
+		int out[5] = {};
+		auto result = ranges::ext::sample(input_iterator<int*>(data),
+			sentinel<int*>(data + 3), out, 5);
+		CHECK(result.out == out + 3);
+		CHECK(result.in == sentinel<int*>(data + 3));
+		CHECK(ranges::equal(ranges::subrange(out, out + 3), data));
+		result = ranges::ext::sample(input_iterator<int*>(data),
+			sentinel<int*>(data + 3), out, 3);
+		CHECK(result.out == out + 3);
+		auto sized = ranges::ext::sample(data, out, 5);
+		CHECK(sized.out == out + 3);
+		CHECK(ranges::equal(ranges::subrange(out, out + 3), data));
+	}
+
+	{
+		// Sampling from a large population draws O(k log(N / k)) numbers.
+		struct counting_engine {
+			using result_type = std::uint64_t;
+			ranges::ext::xoshiro256pp g;
+			long calls = 0;
+			static constexpr result_type min() { return 0; }
+			static constexpr result_type max() { return ~result_type{0}; }
+			result_type operator()() { ++calls; return g(); }
+		} g;
+		std::vector<int> population(1 << 20);
+		std::iota(population.begin(), population.end(), 0);
+		std::vector<int> out(100);
+		ranges::ext::sample(population, out, g);
+		CHECK(g.calls < 2000);
+		CHECK(std::is_sorted(out.begin(), out.end()));
+		g.calls = 0;
+		ranges::ext::sample(input_iterator<int*>(population.data()),
+			sentinel<int*>(population.data() + population.size()), out.begin(), 100, g);
+		CHECK(g.calls < 5000);
+	}
+
 	return ::test_result();
 }
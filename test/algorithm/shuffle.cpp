@@ -68,5 +68,31 @@ int main()
 		CHECK(!stl2::equal(ia, orig));
 	}
 
+	{
+		// Every permutation is equally likely, whether the generator's
+		// words are split in pairs (64-bit) or not.
+		auto check = [](auto g) {
+			int counts[120]{};
+			for (int t = 0; t < 120 * 1000; ++t) {
+				int a[5] = {0, 1, 2, 3, 4};
+				stl2::shuffle(a, g);
+				int rank = 0;
+				for (int i = 0; i < 5; ++i) {
+					int smaller = 0;
+					for (int j = i + 1; j < 5; ++j) smaller += a[j] < a[i];
+					rank = rank * (5 - i) + smaller;
+				}
+				++counts[rank];
+			}
+			for (int c : counts) {
+				CHECK(c > 850);
+				CHECK(c < 1150);
+			}
+		};
+		check(stl2::ext::xoshiro256pp{});
+		check(std::mt19937{});
+		check(std::minstd_rand{});
+	}
+
 	return ::test_result();
 }
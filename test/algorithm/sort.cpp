@@ -180,6 +180,26 @@ test_larger_sorts(unsigned N)
 	test_larger_sorts(N, N);
 }
 
+constexpr bool sorts_at_compile_time()
+{
+	int a[] = {5, 3, 4, 0, 2, 1, 9, 7, 8, 6};
+	ranges::sort(a);
+	for (int i = 0; i < 10; ++i) {
+		if (a[i] != i) return false;
+	}
+	// long enough that sort would count small keys at run time
+	unsigned char b[600] = {};
+	for (int i = 0; i < 600; ++i) {
+		b[i] = static_cast<unsigned char>((599 - i) % 256);
+	}
+	ranges::sort(b);
+	for (int i = 1; i < 600; ++i) {
+		if (b[i - 1] > b[i]) return false;
+	}
+	return true;
+}
+static_assert(sorts_at_compile_time());
+
 struct S
 {
 	int i, j;
@@ -0,0 +1,146 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/sort_by_cached_key.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/is_sorted.hpp>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct S {
+		std::string name;
+		int id;
+	};
+
+	int calls = 0;
+
+	struct name_length {
+		std::size_t operator()(const S& s) const {
+			++calls;
+			return s.name.size();
+		}
+	};
+
+	std::mt19937 gen;
+
+	template<class T>
+	std::vector<T> random_values(std::size_t n, T lo, T hi) {
+		std::vector<T> v(n);
+		if constexpr (std::is_floating_point_v<T>) {
+			std::uniform_real_distribution<T> dist{lo, hi};
+			for (auto& x : v) x = dist(gen);
+		} else {
+			std::uniform_int_distribution<T> dist{lo, hi};
+			for (auto& x : v) x = dist(gen);
+		}
+		return v;
+	}
+
+	// sort_by_cached_key and stable_sort_by_cached_key agree with
+	// stable_sort on random keys with many duplicates, in both directions.
+	template<class T>
+	void test_keys(std::size_t n, T lo, T hi) {
+		struct E { T key; std::size_t pos; };
+		auto keys = random_values(n, lo, hi);
+		std::vector<E> v;
+		for (std::size_t i = 0; i < n; ++i) v.push_back({keys[i], i});
+
+		auto expected = v;
+		std::stable_sort(expected.begin(), expected.end(),
+			[](const E& a, const E& b) { return a.key < b.key; });
+		auto actual = v;
+		ranges::ext::stable_sort_by_cached_key(actual, ranges::less{}, &E::key);
+		CHECK(ranges::equal(actual, expected, ranges::equal_to{}, &E::pos, &E::pos));
+
+		std::stable_sort(expected.begin(), expected.end(),
+			[](const E& a, const E& b) { return a.key > b.key; });
+		actual = v;
+		ranges::ext::stable_sort_by_cached_key(actual, ranges::greater{}, &E::key);
+		CHECK(ranges::equal(actual, expected, ranges::equal_to{}, &E::pos, &E::pos));
+
+		actual = v;
+		CHECK(ranges::ext::sort_by_cached_key(actual, ranges::less{}, &E::key) ==
+			actual.end());
+		CHECK(ranges::is_sorted(actual, ranges::less{}, &E::key));
+	}
+}
+
+int main() {
+	using ranges::ext::sort_by_cached_key;
+	using ranges::ext::stable_sort_by_cached_key;
+
+	{
+		std::vector<S> v = {{"ccc", 0}, {"a", 1}, {"bb", 2}, {"dddd", 3},
+			{"e", 4}, {"ff", 5}};
+		calls = 0;
+		stable_sort_by_cached_key(v, ranges::less{}, name_length{});
+		CHECK(calls == 6);
+		int ids[] = {1, 4, 2, 5, 0, 3};
+		CHECK(ranges::equal(v, ids, ranges::equal_to{}, &S::id));
+
+		calls = 0;
+		CHECK(sort_by_cached_key(v.begin(), v.end(), ranges::greater{}, name_length{})
+			== v.end());
+		CHECK(calls == 6);
+		CHECK(ranges::is_sorted(v, ranges::greater{},
+			[](const S& s) { return s.name.size(); }));
+	}
+	{
+		// Keys that are not arithmetic, and a custom comparison
+		std::vector<std::unique_ptr<int>> v;
+		for (int i : {5, 3, 9, 1, 7}) v.push_back(std::make_unique<int>(i));
+		stable_sort_by_cached_key(v, [](int a, int b) { return a % 3 < b % 3; },
+			[](const std::unique_ptr<int>& p) { return *p; });
+		int values[] = {3, 9, 1, 7, 5};
+		CHECK(ranges::equal(v, values, ranges::equal_to{},
+			[](const std::unique_ptr<int>& p) { return *p; }));
+	}
+	{
+		std::vector<std::string> v = {"pear", "Apple", "fig", "banana"};
+		sort_by_cached_key(v, ranges::less{}, [](const std::string& s) {
+			std::string k;
+			for (char c : s) k += static_cast<char>(c | 0x20);
+			return k;
+		});
+		CHECK_EQUAL(v, {"Apple", "banana", "fig", "pear"});
+	}
+	{
+		int a[] = {0};
+		CHECK(sort_by_cached_key(a, a) == a);
+		CHECK(sort_by_cached_key(a) == a + 1);
+	}
+
+	// Large enough for the radix sort
+	test_keys<int>(5000, -100, 100);
+	test_keys<unsigned>(5000, 0, std::numeric_limits<unsigned>::max());
+	test_keys<long long>(3000, std::numeric_limits<long long>::min(),
+		std::numeric_limits<long long>::max());
+	test_keys<short>(3000, -5, 5);
+	test_keys<double>(3000, -1e6, 1e6);
+	test_keys<float>(3000, -1.0f, 1.0f);
+	test_keys<int>(300, -10, 10);
+	{
+		// -0.0 and +0.0 compare equal, so keep their order.
+		struct E { double key; int pos; };
+		std::vector<E> v;
+		for (int i = 0; i < 1000; ++i) v.push_back({i % 2 ? 0.0 : -0.0, i});
+		stable_sort_by_cached_key(v, ranges::less{}, &E::key);
+		CHECK(ranges::is_sorted(v, ranges::less{}, &E::pos));
+	}
+
+	return ::test_result();
+}
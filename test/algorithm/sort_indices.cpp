@@ -0,0 +1,58 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/sort_indices.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using ranges::ext::sort_indices;
+
+	{
+		int a[] = {30, 10, 20, 10, 40};
+		auto p = sort_indices(a);
+		static_assert(ranges::Same<decltype(p), std::vector<std::ptrdiff_t>>);
+		CHECK_EQUAL(p, {1, 3, 2, 0, 4});
+		CHECK_EQUAL(a, {30, 10, 20, 10, 40});
+
+		p = sort_indices(a, a + 5, ranges::greater{});
+		CHECK_EQUAL(p, {4, 0, 2, 1, 3});
+	}
+	{
+		struct S { std::string name; int age; };
+		std::vector<S> v = {{"c", 2}, {"a", 1}, {"b", 2}, {"d", 1}};
+		auto p = sort_indices(v, ranges::less{}, &S::age);
+		CHECK_EQUAL(p, {1, 3, 0, 2});
+	}
+	{
+		std::vector<int> v;
+		CHECK(sort_indices(v).empty());
+	}
+	{
+		// Agrees with a stable sort of the indices.
+		std::mt19937 gen;
+		std::uniform_int_distribution<int> dist{0, 50};
+		std::vector<int> v(2000);
+		for (auto& x : v) x = dist(gen);
+		std::vector<std::ptrdiff_t> expected(v.size());
+		std::iota(expected.begin(), expected.end(), std::ptrdiff_t{0});
+		std::stable_sort(expected.begin(), expected.end(),
+			[&](std::ptrdiff_t i, std::ptrdiff_t j) { return v[i] < v[j]; });
+		CHECK(ranges::equal(sort_indices(v), expected));
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,91 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/top_k.hpp>
+#include <stl2/detail/algorithm/merge_k.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
+#include <stl2/view/subrange.hpp>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using ranges::ext::top_k;
+
+	std::mt19937 gen{42};
+	std::vector<int> v(10000);
+	for (auto& x : v) x = static_cast<int>(gen() % 3000);
+	std::vector<int> sorted = v;
+	std::sort(sorted.begin(), sorted.end());
+
+	{
+		for (std::ptrdiff_t k : {0, 1, 7, 100, 4999, 5000, 5001, 10000, 20000}) {
+			auto r = top_k(v, k);
+			static_assert(ranges::Same<decltype(r), std::vector<int>>);
+			const auto m = std::min<std::ptrdiff_t>(k, 10000);
+			CHECK(r.size() == static_cast<std::size_t>(m));
+			CHECK(std::equal(r.begin(), r.end(), sorted.begin()));
+		}
+		CHECK(top_k(v, -1).empty());
+	}
+	{
+		// Single pass input, greatest first, through a projection.
+		std::vector<std::pair<int, std::string>> p;
+		for (int i = 0; i < 1000; ++i) {
+			p.emplace_back((i * 7919) % 1000, std::to_string(i));
+		}
+		auto r = top_k(::input_iterator<std::pair<int, std::string>*>(p.data()),
+			::sentinel<std::pair<int, std::string>*>(p.data() + p.size()), 5,
+			ranges::greater{}, &std::pair<int, std::string>::first);
+		CHECK(r.size() == 5u);
+		for (int i = 0; i < 5; ++i) {
+			CHECK(r[i].first == 999 - i);
+			CHECK((std::stoi(r[i].second) * 7919 % 1000) == 999 - i);
+		}
+	}
+	{
+		// Top k of the parts, merged, is the top k of the whole.
+		const std::ptrdiff_t k = 50;
+		std::vector<std::vector<int>> parts = {
+			top_k(ranges::subrange(v.begin(), v.begin() + 3000), k),
+			top_k(ranges::subrange(v.begin() + 3000, v.begin() + 7000), k),
+			top_k(ranges::subrange(v.begin() + 7000, v.end()), k),
+		};
+		std::vector<int> merged;
+		ranges::ext::merge_k(parts, ranges::back_inserter(merged));
+		merged.resize(k);
+		CHECK(merged == top_k(v, k));
+	}
+	{
+		// Which does top_k across threads.
+		std::vector<int> big(200000);
+		for (auto& x : big) x = static_cast<int>(gen() % 1000000);
+		std::vector<int> big_sorted = big;
+		std::sort(big_sorted.begin(), big_sorted.end(), std::greater<>{});
+		for (unsigned threads : {0u, 1u, 2u, 7u, 64u}) {
+			for (std::ptrdiff_t k : {0, 1, 100, 5000, 100000, 300000}) {
+				auto r = top_k(big, k, ranges::greater{}, ranges::identity{}, threads);
+				const auto m = std::min<std::ptrdiff_t>(k, 200000);
+				CHECK(r.size() == static_cast<std::size_t>(m));
+				CHECK(std::equal(r.begin(), r.end(), big_sorted.begin()));
+			}
+		}
+		auto r = top_k(big.begin(), big.end(), 10, ranges::less{}, ranges::identity{}, 4);
+		CHECK(r == top_k(big, 10));
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,111 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/algorithm/weighted_sample.hpp>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	bool near(int count, double n, double p) {
+		return std::abs(count - n * p) <= 4 * std::sqrt(n * p * (1 - p)) + 1;
+	}
+
+	struct item {
+		std::string name;
+		double weight;
+	};
+
+	struct counting_engine {
+		using result_type = std::uint64_t;
+		ranges::ext::xoshiro256pp g;
+		long calls = 0;
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return ~result_type{0}; }
+		result_type operator()() { ++calls; return g(); }
+	};
+}
+
+int main() {
+	using ranges::ext::weighted_sample;
+	auto id = ranges::identity{};
+
+	{
+		// Samples come in the order of successive weighted draws: the
+		// pair (a, b) with probability w_a / W * w_b / (W - w_a).
+		const std::vector<int> w{1, 2, 3, 4};
+		ranges::ext::xoshiro256pp g{1};
+		int counts[5][5] = {};
+		constexpr int n = 200000;
+		for (int t = 0; t < n; ++t) {
+			auto s = weighted_sample(w, id, 2, g);
+			CHECK(s.size() == 2u);
+			++counts[s[0]][s[1]];
+		}
+		for (int a = 1; a <= 4; ++a) {
+			for (int b = 1; b <= 4; ++b) {
+				const double p = a == b ? 0.0 : a / 10.0 * b / (10.0 - a);
+				CHECK(near(counts[a][b], n, p));
+			}
+		}
+	}
+	{
+		// Uniform weights past the first k take the jumps; every element is
+		// as likely as any other to be sampled.
+		std::vector<int> population(1000);
+		std::iota(population.begin(), population.end(), 0);
+		std::vector<int> counts(10);
+		ranges::ext::xoshiro256pp g{2};
+		constexpr int n = 20000;
+		for (int t = 0; t < n; ++t) {
+			for (int x : weighted_sample(population, [](int) { return 1; }, 5, g)) {
+				++counts[x / 100];
+			}
+		}
+		for (int c : counts) CHECK(near(c, 5.0 * n, 0.1));
+
+		// Heavier elements, anywhere in the input, are sampled more: ten of
+		// weight 50 among 990 of weight 1 make 1.602 of each 5 drawn.
+		std::vector<int> inclusions(1000);
+		auto heavy = [](int x) { return x % 100 == 0 ? 50.0 : 1.0; };
+		for (int t = 0; t < n; ++t) {
+			for (int x : weighted_sample(population, heavy, 5, g)) ++inclusions[x];
+		}
+		int heavy_total = 0;
+		for (int x = 0; x < 1000; x += 100) heavy_total += inclusions[x];
+		CHECK(std::abs(heavy_total - 1.602 * n) < 0.02 * n);
+	}
+	{
+		// Elements of weight zero are never sampled.
+		std::vector<item> items{{"a", 0}, {"b", 2}, {"c", 0}, {"d", 1}};
+		for (int t = 0; t < 100; ++t) {
+			auto s = weighted_sample(items, &item::weight, 3);
+			CHECK(s.size() == 2u);
+			for (auto& i : s) CHECK(i.weight > 0);
+		}
+		CHECK(weighted_sample(items, &item::weight, 0).empty());
+	}
+	{
+		// Single-pass input, and few random numbers.
+		std::vector<int> population(1 << 20, 1);
+		counting_engine g;
+		auto s = weighted_sample(input_iterator<int*>(population.data()),
+			sentinel<int*>(population.data() + population.size()), id, 100, g);
+		CHECK(s.size() == 100u);
+		CHECK(g.calls < 5000);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,88 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/alias_table.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+using ranges::ext::alias_table;
+
+namespace {
+	// Draw n times and check each index's frequency against its weight,
+	// within four standard deviations.
+	template<class Gen>
+	bool matches(const alias_table& t, const std::vector<double>& w, Gen& g, int n) {
+		double sum = 0;
+		for (double x : w) sum += x;
+		std::vector<int> counts(w.size());
+		for (int i = 0; i < n; ++i) {
+			const auto j = t(g);
+			if (j >= w.size()) return false;
+			++counts[j];
+		}
+		for (std::size_t j = 0; j < w.size(); ++j) {
+			const double p = w[j] / sum;
+			if (p == 0 && counts[j] != 0) return false;
+			if (std::abs(counts[j] - n * p) > 4 * std::sqrt(n * p * (1 - p)) + 1) return false;
+		}
+		return true;
+	}
+
+	struct server {
+		int id;
+		unsigned capacity;
+	};
+}
+
+int main() {
+	{
+		alias_table t;
+		CHECK(t.empty());
+		CHECK(t.size() == 0u);
+	}
+	{
+		std::vector<double> w{1, 2, 3, 4, 0};
+		alias_table t{w};
+		CHECK(t.size() == 5u);
+		ranges::ext::xoshiro256pp g{1};
+		CHECK(matches(t, w, g, 200000));
+		std::mt19937 mt;
+		CHECK(matches(t, w, mt, 200000));
+	}
+	{
+		alias_table t{std::vector<int>{0, 0, 7, 0}};
+		for (int i = 0; i < 1000; ++i) CHECK(t() == 2u);
+	}
+	{
+		// Skewed and zero weights, and more indices than weight.
+		std::vector<double> w(1000);
+		std::mt19937 gen{7};
+		for (std::size_t i = 0; i < w.size(); ++i) {
+			w[i] = i % 3 == 0 ? 0.0 : std::pow(1.01, static_cast<double>(i % 500));
+		}
+		w[999] = 500;
+		alias_table t{w};
+		CHECK(matches(t, w, gen, 1000000));
+	}
+	{
+		std::vector<server> servers{{10, 1}, {11, 3}, {12, 0}};
+		alias_table t{servers, &server::capacity};
+		ranges::ext::xoshiro256pp g{2};
+		CHECK(matches(t, {1, 3, 0}, g, 100000));
+		CHECK(servers[t(g)].capacity > 0u);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,239 @@
+#include <stl2/detail/flat_hash_map.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/view/iota.hpp>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+using ranges::ext::flat_hash_map;
+using ranges::ext::flat_hash_set;
+
+namespace {
+	struct employee {
+		std::string name;
+		int id;
+	};
+
+	struct badge {
+		int id;
+		operator employee() const { return {"badge", id}; }
+	};
+
+	// Hashing a negative value throws.
+	struct picky {
+		int value;
+		bool operator==(const picky& that) const { return value == that.value; }
+		bool operator!=(const picky& that) const { return !(*this == that); }
+		friend std::size_t hash_value(const picky& p) {
+			if (p.value < 0) throw p;
+			return static_cast<std::size_t>(p.value);
+		}
+	};
+}
+
+int main() {
+	{
+		using S = flat_hash_set<int>;
+		static_assert(ranges::ForwardRange<S>);
+		static_assert(ranges::SizedRange<S>);
+		static_assert(ranges::ForwardRange<const S>);
+		static_assert(ranges::Same<ranges::iter_reference_t<ranges::iterator_t<S>>, const int&>);
+
+		S s;
+		CHECK(s.empty());
+		CHECK(s.begin() == s.end());
+		CHECK(!s.contains(42));
+		CHECK(s.erase(42) == 0u);
+		CHECK(s.insert(3).second);
+		CHECK(!s.insert(3).second);
+		CHECK(s.size() == 1u);
+		CHECK(*s.find(3) == 3);
+		CHECK(s.find(4) == s.end());
+		s.clear();
+		CHECK(s.empty());
+		CHECK(ranges::distance(s) == 0);
+	}
+	{
+		// bulk insert reserves once and deduplicates
+		flat_hash_set<int> s;
+		s.insert(ranges::view::iota(0, 1000));
+		CHECK(s.size() == 1000u);
+		auto cap = s.capacity();
+		s.insert(ranges::view::iota(500, 1000));
+		CHECK(s.capacity() == cap);
+		CHECK(s.size() == 1000u);
+		std::vector<int> v(s.begin(), s.end());
+		ranges::sort(v);
+		for (int i = 0; i < 1000; ++i) CHECK(v[i] == i);
+
+		// construction from a range
+		std::vector<int> w = {3, 1, 3, 2};
+		flat_hash_set<int> t(w);
+		CHECK(t.size() == 3u);
+		flat_hash_set<int> u{ranges::view::iota(0, 10)};
+		CHECK(u.size() == 10u);
+
+		// erase by key and by iterator
+		for (int i = 0; i < 1000; i += 2) CHECK(s.erase(i) == 1u);
+		CHECK(s.size() == 500u);
+		for (auto i = s.begin(); i != s.end();) {
+			if (*i % 3 == 0) i = s.erase(i);
+			else ++i;
+		}
+		for (int i = 0; i < 1000; ++i) {
+			CHECK(s.contains(i) == (i % 2 == 1 && i % 3 != 0));
+		}
+		CHECK(ranges::distance(s) == static_cast<std::ptrdiff_t>(s.size()));
+	}
+	{
+		// heterogeneous lookup
+		flat_hash_set<std::string> s = {"apple", "banana", "cherry"};
+		CHECK(s.contains(std::string_view{"banana"}));
+		CHECK(!s.contains(std::string_view{"durian"}));
+		CHECK(s.erase(std::string_view{"apple"}) == 1u);
+		CHECK(s.size() == 2u);
+
+		// String literals and pointers are converted to std::string, not
+		// hashed as arrays or as pointers.
+		CHECK(s.contains("banana"));
+		CHECK(!s.contains("durian"));
+		const char* p = "cherry";
+		CHECK(s.contains(p));
+		CHECK(s.find(p) != s.end());
+		CHECK(s.count(p) == 1u);
+		CHECK(s.erase("cherry") == 1u);
+		CHECK(s.size() == 1u);
+
+		// Other key types convert too.
+		flat_hash_set<int> ints = {1, 2, 3};
+		CHECK(ints.contains(2L));
+		CHECK(ints.contains(static_cast<short>(3)));
+		CHECK(!ints.contains(4LL));
+	}
+	{
+		// keys by projection
+		flat_hash_set<employee, int employee::*> staff{&employee::id};
+		staff.insert(employee{"ann", 1});
+		staff.insert(employee{"bob", 2});
+		CHECK(!staff.insert(employee{"impostor", 1}).second);
+		CHECK(staff.find(1)->name == "ann");
+		CHECK(staff.size() == 2u);
+
+		// Elements that only convert to employee are projected once converted.
+		std::vector<badge> badges = {{2}, {3}};
+		staff.insert(badges);
+		CHECK(staff.size() == 3u);
+		CHECK(staff.find(2)->name == "bob");
+		CHECK(staff.find(3)->name == "badge");
+	}
+	{
+		// move-only elements; copy and move of the container
+		flat_hash_set<std::unique_ptr<int>> s;
+		for (int i = 0; i < 100; ++i) s.emplace(std::make_unique<int>(i));
+		auto t = std::move(s);
+		CHECK(t.size() == 100u);
+		CHECK(s.empty());
+		CHECK(s.begin() == s.end());
+
+		flat_hash_set<std::string> a = {"x", "y"};
+		auto b = a;
+		b.insert("z");
+		CHECK(a.size() == 2u);
+		CHECK(b.size() == 3u);
+		a = b;
+		CHECK(a.contains(std::string{"z"}));
+	}
+	{
+		flat_hash_map<std::string, int> m;
+		static_assert(ranges::ForwardRange<decltype(m)>);
+		static_assert(ranges::SizedRange<decltype(m)>);
+		static_assert(ranges::Same<ranges::iter_reference_t<ranges::iterator_t<decltype(m)>>,
+			std::pair<const std::string, int>&>);
+		for (auto w : {"a", "b", "a", "c", "a", "b"}) ++m[w];
+		CHECK(m.size() == 3u);
+		CHECK(m.find(std::string_view{"a"})->second == 3);
+		CHECK(m["b"] == 2);
+		CHECK(!m.try_emplace("c", 42).second);
+		CHECK(m["c"] == 1);
+		CHECK(!m.insert_or_assign("c", 42).second);
+		CHECK(m["c"] == 42);
+		for (auto& [k, v] : m) v = -v;
+		CHECK(m["a"] == -3);
+		const auto& cm = m;
+		CHECK(cm.find(std::string{"b"})->second == -2);
+		CHECK(ranges::count(m, std::pair<const std::string, int>{"b", -2}) == 1);
+	}
+	{
+		// map literals
+		flat_hash_map<std::string, int> m = {{"a", 1}, {"b", 2}, {"a", 3}};
+		CHECK(m.size() == 2u);
+		CHECK(m["a"] == 1);
+		m.insert({{"c", 3}, {"b", 4}});
+		CHECK(m.size() == 3u);
+		CHECK(m["b"] == 2);
+		CHECK(m["c"] == 3);
+		flat_hash_map<int, std::string> n{{1, "one"}, {2, "two"}};
+		CHECK(n[2] == "two");
+
+		flat_hash_set<std::string> s = {std::string{"x"}, std::string{"y"}};
+		s.insert({std::string{"z"}});
+		CHECK(s.size() == 3u);
+	}
+	{
+		// randomized against std::unordered_map, with churn
+		std::mt19937 gen;
+		std::uniform_int_distribution<int> dist{0, 4999};
+		flat_hash_map<int, int> m;
+		std::unordered_map<int, int> expected;
+		for (int n = 0; n < 100000; ++n) {
+			const int k = dist(gen);
+			switch (n % 3) {
+			case 0:
+			case 1:
+				m[k] += n;
+				expected[k] += n;
+				break;
+			case 2:
+				CHECK(m.erase(k) == expected.erase(k));
+				break;
+			}
+		}
+		CHECK(m.size() == expected.size());
+		for (auto& [k, v] : expected) {
+			auto i = m.find(k);
+			CHECK(i != m.end());
+			CHECK(i->second == v);
+		}
+		CHECK(ranges::distance(m) == static_cast<std::ptrdiff_t>(expected.size()));
+	}
+
+	{
+		// Exceptions from hashing propagate out of lookups.
+		flat_hash_set<picky> s;
+		s.insert(picky{1});
+		int thrown = 0;
+		try { (void)s.find(picky{-1}); } catch (const picky&) { ++thrown; }
+		try { (void)s.contains(picky{-1}); } catch (const picky&) { ++thrown; }
+		try { (void)s.erase(picky{-1}); } catch (const picky&) { ++thrown; }
+		CHECK(thrown == 3);
+		CHECK(s.contains(picky{1}));
+	}
+
+	{
+		// Equal sets hash equally, whatever order they iterate in.
+		flat_hash_set<int> a, b;
+		b.reserve(1000);
+		for (int i = 0; i < 100; ++i) a.insert(i);
+		for (int i = 99; i >= 0; --i) b.insert(i);
+		CHECK(ranges::ext::hash(a) == ranges::ext::hash(b));
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,169 @@
+#include <stl2/detail/hash.hpp>
+#include <stl2/detail/span.hpp>
+#include <stl2/view/subrange.hpp>
+#include <array>
+#include <list>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+using ranges::ext::hash;
+using ranges::ext::Hashable;
+
+namespace {
+	struct NotHashable {};
+
+	struct Customized {
+		int i;
+		friend std::size_t hash_value(const Customized& c) {
+			return static_cast<std::size_t>(c.i);
+		}
+	};
+
+	enum class E : unsigned char { a, b };
+
+	// Unique object representations, but no hash of its own.
+	struct Plain { int a, b; };
+
+	// Equality, and the hash, ignore the cached field.
+	struct Loose {
+		int value;
+		int cache;
+		bool operator==(const Loose& that) const { return value == that.value; }
+		friend std::size_t hash_value(const Loose& l) {
+			return static_cast<std::size_t>(l.value);
+		}
+	};
+}
+
+static_assert(Hashable<int>);
+static_assert(Hashable<double>);
+static_assert(Hashable<E>);
+static_assert(Hashable<int*>);
+static_assert(Hashable<std::nullptr_t>);
+static_assert(Hashable<std::string>);
+static_assert(Hashable<std::pair<int, std::string>>);
+static_assert(Hashable<std::tuple<>>);
+static_assert(Hashable<std::tuple<int, double, std::string>>);
+static_assert(Hashable<std::vector<std::vector<int>>>);
+static_assert(Hashable<std::list<int>>);
+static_assert(Hashable<ranges::ext::span<const int>>);
+static_assert(Hashable<ranges::subrange<std::list<int>::const_iterator>>);
+static_assert(Hashable<Customized>);
+static_assert(!Hashable<NotHashable>);
+static_assert(!Hashable<std::pair<int, NotHashable>>);
+static_assert(!Hashable<std::vector<NotHashable>>);
+static_assert(!Hashable<Plain>);
+static_assert(!Hashable<std::vector<Plain>>);
+static_assert(Hashable<std::vector<Loose>>);
+
+int main() {
+	// Integers are mixed rather than hashed to themselves.
+	CHECK(hash(0) != 0u);
+	CHECK(hash(1) != 1u);
+	CHECK(hash(1) != hash(2));
+	CHECK(hash(-0.0) == hash(0.0));
+	CHECK(hash(Customized{42}) == 42u);
+
+	{
+		// Low bits of hashes of small consecutive integers are well
+		// distributed: all 256 buckets of a 256-bucket table get used.
+		std::set<std::size_t> buckets;
+		for (int i = 0; i < 4096; ++i) {
+			buckets.insert(hash(i * 1024) & 255);
+		}
+		CHECK(buckets.size() == 256u);
+	}
+
+	{
+		// Contiguous ranges hash structurally, as bytes.
+		std::vector<int> v{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14};
+		std::array<int, 14> a{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14}};
+		ranges::ext::span<const int> s{v};
+		ranges::subrange sub{v.data(), v.data() + v.size()};
+		CHECK(hash(v) == hash(a));
+		CHECK(hash(v) == hash(s));
+		CHECK(hash(v) == hash(sub));
+		CHECK(hash(v) == ranges::ext::hash_bytes(v.data(), v.size() * sizeof(int)));
+		CHECK(hash(s.first(13)) != hash(s));
+		v.back() = 0;
+		CHECK(hash(v) != hash(a));
+	}
+
+	{
+		// ...and so do other ranges, element by element.
+		std::list<int> l{1, 2, 3};
+		std::list<int> l2{1, 2, 3};
+		CHECK(hash(l) == hash(l2));
+		CHECK(hash(ranges::subrange{l.cbegin(), l.cend()}) == hash(l));
+		l2.push_back(0);
+		CHECK(hash(l) != hash(l2));
+
+		// Contiguous ranges of elements with their own hash use it, so
+		// that ranges equal element by element hash equally.
+		std::vector<Loose> x{{1, 10}, {2, 20}};
+		std::vector<Loose> y{{1, 0}, {2, 0}};
+		CHECK(x == y);
+		CHECK(hash(x) == hash(y));
+
+		std::vector<std::string> vs{"foo", "bar"};
+		std::array<std::string, 2> as{{"foo", "bar"}};
+		CHECK(hash(vs) == hash(as));
+	}
+
+	{
+		// Hashed containers hash their elements in any order.
+		std::unordered_set<int> a, b(1024);
+		for (int i = 0; i < 100; ++i) a.insert(i);
+		for (int i = 99; i >= 0; --i) b.insert(i);
+		CHECK(a == b);
+		CHECK(hash(a) == hash(b));
+		b.erase(42);
+		CHECK(hash(a) != hash(b));
+
+		std::unordered_multiset<int> m{1, 1, 2}, m2{1, 2, 2};
+		CHECK(hash(m) != hash(m2));
+
+		std::unordered_map<int, std::string> x, y(1024);
+		x.emplace(1, "one");
+		x.emplace(2, "two");
+		y.emplace(2, "two");
+		y.emplace(1, "one");
+		CHECK(hash(x) == hash(y));
+	}
+
+	{
+		// Strings hash equally regardless of their type.
+		std::string str = "The quick brown fox jumps over the lazy dog";
+		CHECK(hash(str) == hash(std::string_view{str}));
+		for (std::size_t n = 0; n < str.size(); ++n) {
+			CHECK(hash(str.substr(0, n)) != hash(str.substr(0, n + 1)));
+		}
+	}
+
+	{
+		// Tuple-like types hash element by element.
+		CHECK(hash(std::pair{1, 2}) == hash(std::tuple{1, 2}));
+		CHECK(hash(std::pair{1, 2}) != hash(std::pair{2, 1}));
+		CHECK(hash(std::tuple{1, std::string{"x"}}) ==
+			hash(std::tuple{1, std::string{"x"}}));
+	}
+
+	{
+		std::size_t seed = 0;
+		ranges::ext::hash_combine(seed, 42);
+		CHECK(seed != 0u);
+		std::size_t seed2 = 0;
+		ranges::ext::hash_combine(seed2, 43);
+		CHECK(seed != seed2);
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,106 @@
+#include <stl2/detail/indexed_heap.hpp>
+#include <stl2/detail/algorithm/is_sorted.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+using ranges::ext::indexed_heap;
+
+namespace {
+	template<class Heap>
+	std::vector<int> drain(Heap& heap) {
+		std::vector<int> result;
+		while (!heap.empty()) {
+			result.push_back(heap.top());
+			heap.pop();
+		}
+		return result;
+	}
+
+	template<std::size_t Arity>
+	void test_random() {
+		std::mt19937 gen;
+		std::uniform_int_distribution<int> dist{0, 999};
+		indexed_heap<int, ranges::greater, ranges::identity, Arity> heap;
+		std::vector<std::size_t> handles;
+		std::vector<int> expected;
+		for (int i = 0; i < 1000; ++i) {
+			handles.push_back(heap.push(dist(gen)));
+		}
+		CHECK(heap.size() == 1000u);
+
+		// update every third element, erase every seventh
+		for (std::size_t i = 0; i < handles.size(); ++i) {
+			if (i % 7 == 0) {
+				heap.erase(handles[i]);
+				CHECK(!heap.contains(handles[i]));
+			} else {
+				if (i % 3 == 0) {
+					heap.update(handles[i], dist(gen));
+				}
+				expected.push_back(heap[handles[i]]);
+			}
+		}
+		CHECK(heap.size() == expected.size());
+
+		ranges::sort(expected);
+		auto result = drain(heap);
+		CHECK(result == expected);
+	}
+}
+
+int main() {
+	{
+		indexed_heap<int> heap;
+		CHECK(heap.empty());
+		auto h1 = heap.push(3);
+		auto h2 = heap.push(1);
+		auto h3 = heap.push(4);
+		heap.push(1);
+		heap.push(5);
+		CHECK(heap.size() == 5u);
+		CHECK(heap.top() == 5);
+		CHECK(heap[h3] == 4);
+
+		// increase-key
+		heap.update(h2, 9);
+		CHECK(heap.top() == 9);
+		CHECK(heap.top_handle() == h2);
+
+		// decrease-key through the mutable accessor
+		heap[h2] = 0;
+		heap.update(h2);
+		CHECK(heap.top() == 5);
+
+		heap.erase(h1);
+		CHECK(!heap.contains(h1));
+		CHECK(heap.contains(h3));
+		CHECK((drain(heap) == std::vector<int>{5, 4, 1, 0}));
+		CHECK(!heap.contains(h3));
+
+		// handles are reused
+		CHECK(heap.push(42) < 5u);
+	}
+
+	{
+		struct S { int key; int payload; };
+		indexed_heap<S, ranges::greater, int S::*, 4> heap{ranges::greater{}, &S::key};
+		for (int i = 10; i > 0; --i) {
+			heap.push(S{i, -i});
+		}
+		CHECK(heap.top().key == 1);
+		CHECK(heap.top().payload == -1);
+		heap.pop();
+		CHECK(heap.top().key == 2);
+	}
+
+	test_random<2>();
+	test_random<3>();
+	test_random<4>();
+	test_random<8>();
+
+	return ::test_result();
+}
@@ -0,0 +1,102 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/random.hpp>
+#include <stl2/detail/randutils.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+using ranges::ext::xoshiro256pp;
+
+static_assert(ranges::UniformRandomBitGenerator<xoshiro256pp>);
+
+constexpr std::uint64_t third(std::uint64_t seed) {
+	xoshiro256pp g{seed};
+	g.discard(2);
+	return g();
+}
+static_assert(third(42) == 0xfbe07cfb0c24ed8c);
+
+// Each of bound values is drawn about equally often.
+template<class G, class D>
+bool uniform(G& g, D bound, int per_value) {
+	std::vector<int> counts(static_cast<std::size_t>(bound));
+	for (int i = 0; i < per_value * static_cast<int>(bound); ++i) {
+		const D x = ranges::detail::__bounded_random(g, bound);
+		if (x < 0 || x >= bound) return false;
+		++counts[static_cast<std::size_t>(x)];
+	}
+	for (int c : counts) {
+		if (c < per_value * 3 / 4 || c > per_value * 5 / 4) return false;
+	}
+	return true;
+}
+
+int main() {
+	{
+		// Reference outputs for splitmix64-expanded seed 42.
+		xoshiro256pp g{42};
+		CHECK(g() == 0xd0764d4f4476689fu);
+		CHECK(g() == 0x519e4174576f3791u);
+		CHECK(g() == 0xfbe07cfb0c24ed8cu);
+		g.jump();
+		CHECK(g() == 0xdd4b9019a605434du);
+		CHECK(g() == 0x01a64467b7366365u);
+	}
+	{
+		xoshiro256pp a{7}, b{7};
+		CHECK(a == b);
+		a();
+		CHECK(a != b);
+		b.discard(1);
+		CHECK(a == b);
+		b.seed(7);
+		CHECK(a != b);
+		CHECK(xoshiro256pp{} == xoshiro256pp{xoshiro256pp::default_seed});
+
+		std::seed_seq seq{1, 2, 3};
+		xoshiro256pp c{seq};
+		CHECK(c != xoshiro256pp{});
+	}
+	{
+		// 64-bit, 32-bit and other generators.
+		xoshiro256pp g{1};
+		CHECK(uniform(g, 10, 2000));
+		CHECK(uniform(g, std::int64_t{7}, 2000));
+		std::mt19937 mt;
+		CHECK(uniform(mt, 10, 2000));
+		CHECK(uniform(mt, std::int64_t{13}, 2000));
+		std::minstd_rand lcg;
+		CHECK(uniform(lcg, 10, 2000));
+
+		CHECK(ranges::detail::__bounded_random(g, 1) == 0);
+		const auto big = std::int64_t{1} << 62;
+		bool high = false;
+		for (int i = 0; i < 64; ++i) {
+			const auto x = ranges::detail::__bounded_random(g, big);
+			CHECK(x >= 0);
+			CHECK(x < big);
+			high = high || x >= big / 2;
+		}
+		CHECK(high);
+		for (int i = 0; i < 64; ++i) {
+			const auto x = ranges::detail::__bounded_random(mt, big);
+			CHECK(x >= 0);
+			CHECK(x < big);
+		}
+	}
+
+	return ::test_result();
+}
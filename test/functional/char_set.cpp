@@ -0,0 +1,61 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/functional.hpp>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "../simple_test.hpp"
+
+namespace stl2 = __stl2;
+using stl2::ext::char_set;
+
+constexpr char_set vowels{"aeiou"};
+static_assert(vowels('a') && vowels('u') && !vowels('b') && !vowels('\0'));
+static_assert(char_set{} == char_set{""});
+static_assert(char_set{std::string_view{"uoiea"}} == vowels);
+static_assert(char_set{"ab"} != char_set{"abc"});
+// Strings do not silently become sets of characters.
+static_assert(!std::is_convertible_v<const char*, char_set>);
+static_assert(!std::is_convertible_v<std::string_view, char_set>);
+
+static_assert(stl2::Predicate<const char_set&, char>);
+static_assert(stl2::Predicate<const char_set&, unsigned char>);
+static_assert(stl2::Predicate<const char_set&, std::byte>);
+static_assert(!stl2::Predicate<const char_set&, int>);
+static_assert(!stl2::Predicate<const char_set&, bool>);
+
+int main() {
+	{
+		// Every byte value is distinct, whatever its type.
+		for (int c = 0; c < 256; ++c) {
+			char_set set;
+			set.insert(static_cast<unsigned char>(c));
+			for (int d = 0; d < 256; ++d) {
+				CHECK(set(static_cast<unsigned char>(d)) == (c == d));
+				CHECK(set(static_cast<char>(d)) == (c == d));
+				CHECK(set(static_cast<std::byte>(d)) == (c == d));
+			}
+		}
+	}
+	{
+		const std::string s = "\t\n \x80\xff";
+		const char_set set{s};
+		CHECK(set(' '));
+		CHECK(set('\xff'));
+		CHECK(set(static_cast<signed char>(-128)));
+		CHECK(!set('\x7f'));
+		CHECK(stl2::invoke(stl2::ref(set), '\n'));
+	}
+
+	return ::test_result();
+}
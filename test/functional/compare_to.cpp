@@ -0,0 +1,46 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/functional.hpp>
+#include <string>
+#include "../simple_test.hpp"
+
+namespace stl2 = __stl2;
+using stl2::ext::lt, stl2::ext::le, stl2::ext::gt, stl2::ext::ge,
+	stl2::ext::eq, stl2::ext::ne;
+
+static_assert(lt(2)(1) && !lt(2)(2) && !lt(2)(3));
+static_assert(le(2)(1) && le(2)(2) && !le(2)(3));
+static_assert(!gt(2)(1) && !gt(2)(2) && gt(2)(3));
+static_assert(!ge(2)(1) && ge(2)(2) && ge(2)(3));
+static_assert(!eq(2)(1) && eq(2)(2) && !eq(2)(3));
+static_assert(ne(2)(1) && !ne(2)(2) && ne(2)(3));
+
+static_assert(stl2::Same<decltype(lt(1.0)), stl2::ext::compare_to<stl2::less, double>>);
+static_assert(stl2::Predicate<decltype(lt(1)), long>);
+static_assert(!stl2::Predicate<decltype(lt(1)), std::string>);
+
+int main() {
+	{
+		// The element is on the left.
+		const auto p = lt(std::string{"b"});
+		CHECK(p("a"));
+		CHECK(!p(std::string{"c"}));
+		CHECK(p.value == "b");
+	}
+	{
+		const auto p = stl2::ext::compare_to<stl2::greater, int>{5};
+		CHECK(stl2::invoke(p, 6));
+		CHECK(!stl2::invoke(stl2::ref(p), 5));
+	}
+
+	return ::test_result();
+}
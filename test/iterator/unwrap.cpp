@@ -0,0 +1,167 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2015
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/detail/iterator/unwrap.hpp>
+#include <stl2/iterator.hpp>
+#include <stl2/algorithm.hpp>
+#include <list>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace lib {
+	// A forward iterator adaptor - a checked iterator, say - that opts in
+	// to unwrapping.
+	template<class I>
+	struct forward_wrapper {
+		using value_type = ranges::iter_value_t<I>;
+		using difference_type = ranges::iter_difference_t<I>;
+		using iterator_category = ranges::forward_iterator_tag;
+
+		I base;
+
+		ranges::iter_reference_t<I> operator*() const { return *base; }
+		forward_wrapper& operator++() { ++base; return *this; }
+		forward_wrapper operator++(int) { auto tmp = *this; ++base; return tmp; }
+		friend bool operator==(const forward_wrapper& x, const forward_wrapper& y)
+		{ return x.base == y.base; }
+		friend bool operator!=(const forward_wrapper& x, const forward_wrapper& y)
+		{ return !(x == y); }
+
+		friend ranges::ext::unwrap_result<I>
+		unwrap(forward_wrapper first, forward_wrapper last)
+		{ return {first.base, last.base}; }
+
+		template<class UI>
+		friend forward_wrapper rewrap(forward_wrapper first, const UI& ufirst, UI upos)
+		{ return {ranges::ext::rewrap(first.base, ufirst, upos)}; }
+	};
+
+	// Without a rewrap, a forward iterator cannot be unwrapped.
+	template<class I>
+	struct lossy_wrapper : forward_wrapper<I> {
+		lossy_wrapper& operator++() { ++this->base; return *this; }
+		lossy_wrapper operator++(int) { auto tmp = *this; ++this->base; return tmp; }
+
+		friend ranges::ext::unwrap_result<I>
+		unwrap(lossy_wrapper first, lossy_wrapper last)
+		{ return {first.base, last.base}; }
+		template<class UI>
+		friend void rewrap(lossy_wrapper, const UI&, UI) {}
+	};
+}
+
+int main() {
+	using ranges::ext::unwrap;
+	using ranges::ext::Unwrappable;
+	using ranges::ext::unwrapped_iterator_t;
+	using VI = std::vector<int>::iterator;
+	using LI = std::list<int>::iterator;
+	using CI = ranges::counted_iterator<VI>;
+
+	static_assert(!Unwrappable<int*, int*>);
+	static_assert(!Unwrappable<LI, LI>);
+	static_assert(!Unwrappable<ranges::counted_iterator<LI>, ranges::default_sentinel>);
+	static_assert(Unwrappable<VI, VI>);
+	static_assert(ranges::Same<unwrapped_iterator_t<VI, VI>, int*>);
+	static_assert(Unwrappable<CI, ranges::default_sentinel>);
+	static_assert(ranges::Same<unwrapped_iterator_t<CI, ranges::default_sentinel>, int*>);
+	static_assert(ranges::Same<unwrapped_iterator_t<CI, CI>, int*>);
+	static_assert(ranges::Same<
+		unwrapped_iterator_t<ranges::counted_iterator<int*>, ranges::default_sentinel>, int*>);
+
+	std::vector<int> v{5, 3, 8, 1, 9, 2, 7};
+
+	{
+		auto [f, l] = unwrap(v.begin(), v.end());
+		CHECK(f == v.data());
+		CHECK(l == v.data() + v.size());
+		auto [cf, cl] = unwrap(CI{v.begin() + 1, 3}, ranges::default_sentinel{});
+		CHECK(cf == v.data() + 1);
+		CHECK(cl == v.data() + 4);
+	}
+	{
+		std::vector<int> empty;
+		auto [f, l] = unwrap(empty.begin(), empty.end());
+		CHECK(f == l);
+	}
+	{
+		auto r = ranges::ext::rewrap(CI{v.begin(), 7}, v.data(), v.data() + 3);
+		CHECK(r.base() == v.begin() + 3);
+		CHECK(r.count() == 4);
+	}
+
+	// Algorithms return positions of the original iterator type.
+	{
+		auto i = ranges::find(CI{v.begin(), 7}, ranges::default_sentinel{}, 9);
+		CHECK(i.base() == v.begin() + 4);
+		CHECK(i.count() == 3);
+		auto j = ranges::find(CI{v.begin(), 4}, ranges::default_sentinel{}, 9);
+		CHECK(j.count() == 0);
+		CHECK(ranges::count(CI{v.begin(), 5}, ranges::default_sentinel{}, 1) == 1);
+	}
+	{
+		int out[7] = {};
+		auto [in, o] = ranges::copy(CI{v.begin(), 4}, ranges::default_sentinel{},
+			ranges::counted_iterator{out + 1, 6});
+		CHECK(in.count() == 0);
+		CHECK(in.base() == v.begin() + 4);
+		CHECK(o.base() == out + 5);
+		CHECK(o.count() == 2);
+		CHECK(out[0] == 0);
+		CHECK(out[1] == 5);
+		CHECK(out[4] == 1);
+		CHECK(out[5] == 0);
+	}
+	{
+		auto last = ranges::sort(CI{v.begin() + 1, 5}, ranges::default_sentinel{});
+		CHECK(last.count() == 0);
+		CHECK(last.base() == v.begin() + 6);
+		CHECK(v == std::vector<int>{5, 1, 2, 3, 8, 9, 7});
+	}
+	{
+		// Adaptors that customize unwrap are unwrapped through their bases.
+		using W = lib::forward_wrapper<VI>;
+		static_assert(ranges::ForwardIterator<W>);
+		static_assert(Unwrappable<W, W>);
+		static_assert(ranges::Same<unwrapped_iterator_t<W, W>, int*>);
+		static_assert(ranges::Same<unwrapped_iterator_t<lib::forward_wrapper<LI>,
+			lib::forward_wrapper<LI>>, LI>);
+		static_assert(ranges::ForwardIterator<lib::lossy_wrapper<VI>>);
+		static_assert(!Unwrappable<lib::lossy_wrapper<VI>, lib::lossy_wrapper<VI>>);
+
+		const W first{v.begin()}, last{v.end()};
+		auto [f, l] = unwrap(first, last);
+		CHECK(f == v.data());
+		CHECK(l == v.data() + v.size());
+		W i = ranges::find(first, last, 9);
+		CHECK(i.base == v.begin() + 5);
+		CHECK(ranges::count_if(first, last, [](int x) { return x > 4; }) == 4);
+		int out[7] = {};
+		auto [in, o] = ranges::copy(first, last, out);
+		CHECK(in == last);
+		CHECK(o == out + 7);
+		CHECK(ranges::equal(out, v));
+
+		CHECK(ranges::any_of(first, last, [](int x) { return x == 7; }));
+		CHECK(ranges::adjacent_find(first, last, ranges::less{}).base == v.begin() + 1);
+		CHECK(ranges::is_sorted_until(W{v.begin() + 1}, last).base == v.begin() + 6);
+		auto [tin, tout] = ranges::transform(first, last, out, [](int x) { return -x; });
+		CHECK(tin == last);
+		CHECK(tout == out + 7);
+		CHECK(out[6] == -7);
+		CHECK(ranges::replace(first, last, 9, 4) == last);
+		CHECK(v == std::vector<int>{5, 1, 2, 3, 8, 4, 7});
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,77 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/cache1.hpp>
+
+#include <stl2/detail/algorithm/find_if.hpp>
+#include <stl2/view/transform_cached.hpp>
+#include <string>
+#include <vector>
+
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	int calls = 0;
+
+	struct decode {
+		std::string operator()(int i) const {
+			++calls;
+			return std::string(static_cast<std::size_t>(i), 'x');
+		}
+	};
+}
+
+int main() {
+	using namespace ranges;
+
+	{
+		std::vector<int> v = {1, 4, 2, 5, 3};
+		auto rng = v | view::ext::transform_cached(decode{}) | view::ext::cache1;
+		using R = decltype(rng);
+		static_assert(View<R>);
+		static_assert(InputRange<R>);
+		static_assert(!ForwardRange<R>);
+		static_assert(SizedRange<R>);
+		static_assert(Same<iter_reference_t<iterator_t<R>>, std::string&>);
+		static_assert(Same<iter_rvalue_reference_t<iterator_t<R>>, std::string&&>);
+		CHECK(size(rng) == 5u);
+
+		calls = 0;
+		auto i = begin(rng);
+		CHECK(*i == "x");
+		CHECK(*i == "x");
+		CHECK(calls == 1);
+		++i;
+		CHECK((*i).size() == 4u);
+		CHECK(calls == 2);
+
+		// A second pass starts over.
+		calls = 0;
+		std::size_t total = 0;
+		for (auto&& s : rng) {
+			total += s.size();
+			total += s.size();
+		}
+		CHECK(total == 30u);
+		CHECK(calls == 5);
+	}
+	{
+		// Searching and then reading the result decodes each element once.
+		std::vector<int> v = {1, 4, 2, 5, 3};
+		auto rng = v | view::ext::transform_cached(decode{}) | view::ext::cache1;
+		calls = 0;
+		auto i = find_if(rng, [](const std::string& s) { return s.size() > 3; });
+		CHECK(*i == "xxxx");
+		CHECK(calls == 2);
+	}
+
+	return ::test_result();
+}
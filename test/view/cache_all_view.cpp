@@ -0,0 +1,149 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/cache_all.hpp>
+
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/view/cache1.hpp>
+#include <stl2/view/transform_cached.hpp>
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	int calls = 0;
+
+	struct twice {
+		int operator()(int i) const {
+			++calls;
+			return 2 * i;
+		}
+	};
+
+	// A view of a queue that consumes it as it is read, like a stream.
+	class consuming_view : public ranges::view_interface<consuming_view> {
+		std::deque<int>* queue_ = nullptr;
+
+		class iterator {
+			std::deque<int>* queue_ = nullptr;
+		public:
+			using value_type = int;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = ranges::input_iterator_tag;
+
+			iterator() = default;
+			explicit iterator(std::deque<int>& queue) : queue_{&queue} {}
+
+			int operator*() const { return queue_->front(); }
+			iterator& operator++() { queue_->pop_front(); return *this; }
+			void operator++(int) { ++*this; }
+
+			friend bool operator==(const iterator& i, ranges::default_sentinel)
+			{ return i.queue_->empty(); }
+			friend bool operator==(ranges::default_sentinel s, const iterator& i)
+			{ return i == s; }
+			friend bool operator!=(const iterator& i, ranges::default_sentinel s)
+			{ return !(i == s); }
+			friend bool operator!=(ranges::default_sentinel s, const iterator& i)
+			{ return !(i == s); }
+		};
+	public:
+		consuming_view() = default;
+		explicit consuming_view(std::deque<int>& queue) : queue_{&queue} {}
+
+		iterator begin() const { return iterator{*queue_}; }
+		ranges::default_sentinel end() const { return {}; }
+	};
+}
+
+int main() {
+	using namespace ranges;
+
+	{
+		std::vector<int> v = {3, 1, 4, 1, 5};
+		auto rng = v | view::ext::transform_cached(twice{}) | view::ext::cache_all;
+		using R = decltype(rng);
+		static_assert(View<R>);
+		static_assert(RandomAccessRange<R>);
+		static_assert(CommonRange<R>);
+		static_assert(SizedRange<R>);
+		static_assert(Same<iter_reference_t<iterator_t<R>>, int&>);
+
+		calls = 0;
+		CHECK_EQUAL(rng, {6, 2, 8, 2, 10});
+		CHECK(count(rng, 2) == 2);
+		CHECK(rng[2] == 8);
+		CHECK(size(rng) == 5u);
+		CHECK(data(rng)[4] == 10);
+		CHECK(calls == 5);
+
+		// Copies share the buffer.
+		auto copy = rng;
+		CHECK(copy.size() == 5u);
+		CHECK_EQUAL(copy, {6, 2, 8, 2, 10});
+		CHECK(calls == 5);
+	}
+	{
+		// An input view becomes multi-pass.
+		std::vector<int> v = {1, 2, 3, 4};
+		auto input = v | view::ext::cache1;
+		static_assert(!ForwardRange<decltype(input)>);
+		auto rng = input | view::ext::cache_all;
+		auto before = rng;
+		CHECK_EQUAL(rng, {1, 2, 3, 4});
+		CHECK_EQUAL(rng, {1, 2, 3, 4});
+		auto after = rng;
+		CHECK_EQUAL(after, {1, 2, 3, 4});
+		CHECK_EQUAL(before, {1, 2, 3, 4});
+	}
+	{
+		// Copies, taken before or after the first pass, of a view of an
+		// input that is consumed as it is read.
+		std::deque<int> queue = {5, 6, 7};
+		static_assert(InputRange<consuming_view> && !ForwardRange<consuming_view>);
+		auto rng = consuming_view{queue} | view::ext::cache_all;
+		auto before = rng;
+		CHECK_EQUAL(rng, {5, 6, 7});
+		CHECK(queue.empty());
+		auto after = rng;
+		CHECK_EQUAL(after, {5, 6, 7});
+		CHECK_EQUAL(before, {5, 6, 7});
+	}
+	{
+		// Copies taken before the first pass share the one it makes.
+		calls = 0;
+		std::vector<int> v = {1, 2, 3};
+		auto rng = v | view::ext::transform_cached(twice{}) | view::ext::cache_all;
+		auto copy = rng;
+		CHECK_EQUAL(copy, {2, 4, 6});
+		CHECK_EQUAL(rng, {2, 4, 6});
+		CHECK(calls == 3);
+	}
+	{
+		// A moved-from view can still be read, and reassigned.
+		std::vector<int> v = {1, 2, 3};
+		auto rng = v | view::ext::cache_all;
+		CHECK_EQUAL(rng, {1, 2, 3});
+		auto moved = std::move(rng);
+		CHECK_EQUAL(moved, {1, 2, 3});
+		CHECK_EQUAL(rng, {1, 2, 3});
+		std::vector<int> w = {4, 5};
+		rng = w | view::ext::cache_all;
+		moved = std::move(rng);
+		CHECK_EQUAL(moved, {4, 5});
+		CHECK_EQUAL(rng, {4, 5});
+	}
+
+	return ::test_result();
+}
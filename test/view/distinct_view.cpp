@@ -0,0 +1,116 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/distinct.hpp>
+
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/view/iota.hpp>
+#include <forward_list>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	struct S {
+		int key;
+		int payload;
+	};
+}
+
+int main() {
+	using namespace ranges;
+
+	{
+		int rgi[] = {3, 1, 3, 2, 1, 4, 2, 3};
+		auto rng = rgi | view::ext::distinct;
+		using R = decltype(rng);
+		static_assert(View<R>);
+		static_assert(CommonRange<R>);
+		static_assert(BidirectionalRange<R>);
+		static_assert(!RandomAccessRange<R>);
+		static_assert(!SizedRange<R>);
+		CHECK_EQUAL(rng, {3, 1, 2, 4});
+
+		// backwards, and again forwards
+		auto i = end(rng);
+		--i;
+		CHECK(*i == 4);
+		--i;
+		CHECK(*i == 2);
+		--i; --i;
+		CHECK(i == begin(rng));
+		CHECK_EQUAL(rng, {3, 1, 2, 4});
+	}
+	{
+		// backwards from end() with no forward pass first: the trailing
+		// duplicate is not a first occurrence.
+		int rgi[] = {1, 2, 1};
+		auto rng = rgi | view::ext::distinct;
+		auto i = end(rng);
+		--i;
+		CHECK(&*i == rgi + 1);
+		--i;
+		CHECK(&*i == rgi);
+		CHECK(i == begin(rng));
+	}
+	{
+		// ... from a copy of the view, whose index starts empty
+		std::list<int> l = {5, 5, 6, 5, 7, 6};
+		auto rng = view::ext::distinct(l);
+		CHECK_EQUAL(rng, {5, 6, 7});
+		auto copy = rng;
+		std::vector<int> backwards;
+		for (auto i = end(copy); i != begin(copy);) backwards.push_back(*--i);
+		CHECK_EQUAL(backwards, {7, 6, 5});
+	}
+	{
+		// iterators over the same view are independent
+		std::vector<int> v = {1, 1, 2, 1, 3, 2};
+		auto rng = ext::distinct_view{v};
+		auto i = begin(rng);
+		auto j = i;
+		++i; ++i;
+		CHECK(*i == 3);
+		++j;
+		CHECK(*j == 2);
+		++j;
+		CHECK(i == j);
+		CHECK(++i == end(rng));
+	}
+	{
+		std::forward_list<std::string> l = {"b", "a", "b", "c", "a"};
+		auto rng = view::ext::distinct(l);
+		static_assert(ForwardRange<decltype(rng)>);
+		static_assert(!BidirectionalRange<decltype(rng)>);
+		CHECK_EQUAL(rng, {"b", "a", "c"});
+	}
+	{
+		S a[] = {{1, 0}, {2, 1}, {1, 2}, {3, 3}, {2, 4}};
+		auto rng = a | view::ext::distinct(&S::key);
+		std::vector<int> payloads;
+		for (auto& s : rng) payloads.push_back(s.payload);
+		CHECK_EQUAL(payloads, {0, 1, 3});
+	}
+	{
+		auto rng = view::iota(0, 1000) | view::ext::distinct([](int i) { return i % 7; });
+		CHECK(count(rng, 0) == 1);
+		CHECK_EQUAL(rng, {0, 1, 2, 3, 4, 5, 6});
+	}
+	{
+		std::list<int> empty;
+		auto rng = view::ext::distinct(empty);
+		CHECK(begin(rng) == end(rng));
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,114 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Copyright Casey Carter 2016
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/join.hpp>
+#include <stl2/view/subrange.hpp>
+#include <stl2/detail/algorithm/copy.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/count_if.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <stl2/detail/algorithm/find_if.hpp>
+#include <stl2/detail/algorithm/for_each.hpp>
+#include <stl2/detail/iterator/insert_iterators.hpp>
+#include <stl2/detail/iterator/operations.hpp>
+#include <vector>
+#include <string>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main()
+{
+	using namespace ranges;
+
+	std::vector<std::vector<int>> vv{{}, {0, 1, 2}, {}, {}, {3}, {4, 5, 6, 7}, {}};
+	join_view jv{vv};
+	using J = iterator_t<decltype(jv)>;
+	static_assert(ext::SegmentedIterator<J>);
+	static_assert(ext::SegmentedSentinel<J, J>);
+	static_assert(!ext::SegmentedIterator<std::vector<int>::iterator>);
+
+	// Whole range
+	{
+		int sum = 0;
+		auto [i, f] = for_each(jv, [&sum](int x) { sum += x; });
+		CHECK(i == jv.end());
+		CHECK(sum == 28);
+		CHECK(count(jv, 5) == 1);
+		CHECK(count_if(jv, [](int x) { return x % 2 == 0; }) == 4);
+
+		std::vector<int> out;
+		auto [in, o] = copy(jv, back_inserter(out));
+		CHECK(in == jv.end());
+		CHECK_EQUAL(out, {0, 1, 2, 3, 4, 5, 6, 7});
+
+		int arr[8] = {};
+		auto r = ext::copy(jv, arr);
+		CHECK(r.out == arr + 8);
+		CHECK_EQUAL(arr, {0, 1, 2, 3, 4, 5, 6, 7});
+	}
+
+	// Positions found in later segments compose correctly.
+	{
+		auto i = find(jv, 4);
+		CHECK(i == next(jv.begin(), 4));
+		CHECK(*i == 4);
+		CHECK(*++i == 5);
+		CHECK(find(jv, 42) == jv.end());
+		auto j = find_if(jv, [](int x) { return x > 2; });
+		CHECK(*j == 3);
+		CHECK(next(j) == next(jv.begin(), 4));
+	}
+
+	// Subranges that begin and end mid-segment
+	{
+		auto first = next(jv.begin(), 1);
+		auto last = next(jv.begin(), 6);
+		CHECK(count_if(first, last, [](int) { return true; }) == 5);
+		CHECK(find(first, last, 7) == last);
+		CHECK(find(first, last, 5) == next(jv.begin(), 5));
+		std::vector<int> out;
+		CHECK(copy(first, last, back_inserter(out)).in == last);
+		CHECK_EQUAL(out, {1, 2, 3, 4, 5});
+		out.clear();
+		copy(next(first), next(first, 1), back_inserter(out));
+		CHECK(out.empty());
+		CHECK(count(jv.end(), jv.end(), 0) == 0);
+	}
+
+	// A non-common outer range ends in a join_view sentinel.
+	{
+		join_view cj{subrange{counted_iterator{vv.begin(), 6}, default_sentinel{}}};
+		static_assert(!CommonRange<decltype(cj)>);
+		static_assert(ext::SegmentedSentinel<sentinel_t<decltype(cj)>,
+			iterator_t<decltype(cj)>>);
+		std::vector<int> out;
+		auto [in, o] = copy(cj, back_inserter(out));
+		CHECK(in == cj.end());
+		CHECK_EQUAL(out, {0, 1, 2, 3, 4, 5, 6, 7});
+		CHECK(count(cj, 7) == 1);
+		CHECK(find(cj, 9) == cj.end());
+		CHECK(*find(cj, 6) == 6);
+	}
+
+	// Strings as segments
+	{
+		std::vector<std::string> vs{"this", "is", "", "his", "face"};
+		join_view sv{vs};
+		CHECK(count(sv, 's') == 3);
+		CHECK(find(sv, 'f') == next(sv.begin(), 9));
+		std::string out;
+		copy(sv, back_inserter(out));
+		CHECK(out == "thisishisface");
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,68 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/merge_k.hpp>
+#include <stl2/detail/algorithm/count.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/find.hpp>
+#include <string>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using namespace ranges;
+
+	{
+		std::vector<std::vector<int>> runs = {{1, 4, 7}, {2, 5, 8}, {}, {0, 3, 6, 9}};
+		auto rng = runs | view::ext::merge_k;
+		using R = decltype(rng);
+		static_assert(View<R>);
+		static_assert(InputRange<R>);
+		static_assert(!ForwardRange<R>);
+		static_assert(Same<iter_reference_t<iterator_t<R>>, int&>);
+		CHECK_EQUAL(rng, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+		// Restartable
+		CHECK_EQUAL(rng, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+		// Elements are those of the runs.
+		*ranges::find(rng, 5) = 50;
+		CHECK(runs[1][1] == 50);
+	}
+	{
+		// Stops early without merging the rest.
+		std::vector<std::vector<std::string>> runs = {
+			{"d", "c", "a"}, {"e", "b"}};
+		auto rng = view::ext::merge_k(runs, greater{});
+		CHECK_EQUAL(rng, {"e", "d", "c", "b", "a"});
+		auto i = rng.begin();
+		CHECK(*i == "e");
+		++i;
+		CHECK(*i == "d");
+		std::string s = iter_move(i);
+		CHECK(s == "d");
+		CHECK(runs[0][0].empty());
+	}
+	{
+		struct S { int key; int id; };
+		std::vector<std::vector<S>> runs = {{{1, 0}, {2, 0}}, {{1, 1}, {2, 1}}};
+		auto rng = runs | view::ext::merge_k(less{}, &S::key);
+		int ids[] = {0, 1, 0, 1};
+		CHECK(ranges::equal(rng, ids, equal_to{}, &S::id));
+		CHECK(ranges::count(rng, 2, &S::key) == 2);
+	}
+	{
+		std::vector<std::vector<int>> runs;
+		auto rng = view::ext::merge_k(runs);
+		CHECK(rng.begin() == rng.end());
+	}
+
+	return ::test_result();
+}
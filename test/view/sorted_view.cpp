@@ -0,0 +1,137 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/sorted.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/view/drop.hpp>
+#include <stl2/view/ref.hpp>
+#include <stl2/view/take.hpp>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using namespace ranges;
+
+	std::mt19937 gen{42};
+	std::vector<int> data(10000);
+	for (auto& x : data) x = static_cast<int>(gen() % 5000);
+	std::vector<int> expected = data;
+	std::sort(expected.begin(), expected.end());
+
+	{
+		auto v = data;
+		auto rng = v | view::ext::sorted;
+		using R = decltype(rng);
+		static_assert(View<R>);
+		static_assert(RandomAccessRange<R>);
+		static_assert(CommonRange<R>);
+		static_assert(SizedRange<R>);
+		static_assert(Same<iter_reference_t<iterator_t<R>>, int&>);
+		CHECK(rng.size() == v.size());
+		CHECK(ranges::equal(rng, expected));
+		CHECK(v == expected);
+	}
+	{
+		// Pages of a ranking, read one after another, sort only what is read.
+		auto v = data;
+		long comparisons = 0;
+		auto counting_less = [&comparisons](int x, int y) {
+			++comparisons;
+			return x < y;
+		};
+		auto rng = view::ext::sorted(v, counting_less);
+		for (int page = 0; page < 3; ++page) {
+			auto p = view::ext::ref(rng) | view::ext::drop(10 * page) | view::take(10);
+			CHECK(ranges::equal(p, view::take(view::ext::drop(expected, 10 * page), 10)));
+		}
+		CHECK(comparisons < 6 * static_cast<long>(v.size()));
+		CHECK(!std::is_sorted(v.begin(), v.end()));
+		CHECK(std::is_sorted(v.begin(), v.begin() + 30));
+	}
+	{
+		// Random access out of order, descending through a projection.
+		std::vector<std::pair<int, std::string>> v;
+		for (int i = 0; i < 1000; ++i) {
+			v.emplace_back((i * 7919) % 1000, std::to_string(i));
+		}
+		auto rng = view::ext::sorted(v, greater{}, &std::pair<int, std::string>::first);
+		auto it = rng.begin();
+		CHECK(it[500].first == 499);
+		CHECK(it[10].first == 989);
+		CHECK((*(rng.end() - 1)).first == 0);
+		CHECK((*it).first == 999);
+		std::pair<int, std::string> moved = iter_move(it + 1);
+		CHECK(moved.first == 998);
+		CHECK((std::stoi(moved.second) * 7919 % 1000) == 998);
+	}
+	{
+		// A copy taken partway through stays consistent with the original.
+		auto v = data;
+		auto rng = view::ext::sorted(v);
+		CHECK(rng.begin()[100] == expected[100]);
+		auto copy = rng;
+		CHECK(rng.begin()[5000] == expected[5000]);
+		CHECK(ranges::equal(copy, expected));
+	}
+	{
+		// Reading through a copy that fell behind does not undo the
+		// progress of one read further.
+		auto v = data;
+		auto rng = view::ext::sorted(v);
+		CHECK(rng.begin()[100] == expected[100]);
+		auto early = rng | view::take(300);
+		CHECK(rng.begin()[5000] == expected[5000]);
+		CHECK(ranges::equal(early, view::take(expected, 300)));
+		CHECK(ranges::equal(rng, expected));
+	}
+	{
+		// Pages copied from one view share its progress.
+		auto v = data;
+		long comparisons = 0;
+		auto rng = view::ext::sorted(v, [&comparisons](int x, int y) {
+			++comparisons;
+			return x < y;
+		});
+		for (int page = 0; page < 3; ++page) {
+			auto p = rng | view::ext::drop(10 * page) | view::take(10);
+			CHECK(ranges::equal(p, view::take(view::ext::drop(expected, 10 * page), 10)));
+		}
+		CHECK(comparisons < 6 * static_cast<long>(v.size()));
+		CHECK(std::is_sorted(v.begin(), v.begin() + 30));
+	}
+	{
+		// A moved-from view can still be read, and reassigned.
+		auto v = data;
+		auto w = data;
+		auto rng = view::ext::sorted(v);
+		CHECK(rng.begin()[10] == expected[10]);
+		auto moved = std::move(rng);
+		CHECK(ranges::equal(moved, expected));
+		CHECK(ranges::equal(rng, expected));
+		rng = view::ext::sorted(w);
+		moved = std::move(rng);
+		CHECK(ranges::equal(rng, expected));
+		CHECK(ranges::equal(moved, expected));
+		CHECK(w == expected);
+	}
+	{
+		std::vector<int> v;
+		auto rng = v | view::ext::sorted(std::greater<>{});
+		CHECK(rng.begin() == rng.end());
+	}
+
+	return ::test_result();
+}
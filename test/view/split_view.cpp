@@ -215,5 +215,37 @@ int main() {
 		CHECK(i == sv.end());
 	}
 
+	{
+		// Each member of an ext::char_set delimits a subrange.
+		std::string text = "a,b;;c d,";
+		split_view sv{text, ext::char_set{",; "}};
+		static_assert(Same<decltype(sv), split_view<ref_view<std::string>, ext::char_set>>);
+		auto i = sv.begin();
+		CHECK_EQUAL(*i, {'a'});
+		++i;
+		CHECK_EQUAL(*i, {'b'});
+		++i;
+		CHECK(distance(*i) == 0);
+		++i;
+		CHECK_EQUAL(*i, {'c'});
+		++i;
+		CHECK_EQUAL(*i, {'d'});
+		++i;
+		CHECK(i == sv.end());
+	}
+
+	{
+		// Delimiters beyond the first vector of the text.
+		std::string text(40, 'x');
+		text[33] = '\n';
+		auto sv = text | view::split(ext::char_set{"\n"});
+		auto i = sv.begin();
+		CHECK(distance(*i) == 33);
+		++i;
+		CHECK(distance(*i) == 6);
+		++i;
+		CHECK(i == sv.end());
+	}
+
 	return test_result();
 }
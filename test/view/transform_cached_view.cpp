@@ -0,0 +1,98 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/transform_cached.hpp>
+
+#include <stl2/detail/algorithm/adjacent_find.hpp>
+#include <stl2/detail/algorithm/max_element.hpp>
+#include <stl2/view/subrange.hpp>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+namespace {
+	int calls = 0;
+
+	struct square {
+		int operator()(int i) const {
+			++calls;
+			return i * i;
+		}
+	};
+}
+
+int main() {
+	using namespace ranges;
+
+	{
+		std::vector<int> v = {3, -7, 1, 6, -2, 5};
+		auto rng = v | view::ext::transform_cached(square{});
+		using R = decltype(rng);
+		static_assert(View<R>);
+		static_assert(CommonRange<R>);
+		static_assert(RandomAccessRange<R>);
+		static_assert(SizedRange<R>);
+		static_assert(Same<iter_reference_t<iterator_t<R>>, int>);
+		CHECK(size(rng) == 6u);
+		CHECK_EQUAL(rng, {9, 49, 1, 36, 4, 25});
+
+		// Each position an iterator visits is computed once.
+		calls = 0;
+		auto i = max_element(rng);
+		CHECK(*i == 49);
+		CHECK(distance(begin(rng), i) == 1);
+		CHECK(calls <= 7);
+
+		calls = 0;
+		auto j = begin(rng) + 3;
+		CHECK(*j == 36);
+		CHECK(*j == 36);
+		CHECK(j[0] == 36);
+		auto k = j;
+		CHECK(*k == 36);
+		CHECK(calls == 1);
+		CHECK(j[-1] == 1);
+		--j;
+		CHECK(*j == 1);
+		CHECK(iter_move(j) == 1);
+		CHECK(*j == 1);
+		CHECK(calls == 4);
+	}
+	{
+		std::list<std::string> l = {"a", "bb", "cc", "ddd"};
+		auto rng = ext::transform_cached_view{l, [](const std::string& s) {
+			++calls;
+			return s.size();
+		}};
+		static_assert(BidirectionalRange<decltype(rng)>);
+		static_assert(!RandomAccessRange<decltype(rng)>);
+		// One call per element visited; transform_view would make four.
+		calls = 0;
+		auto i = adjacent_find(rng);
+		CHECK(i != end(rng));
+		CHECK(*i == 2u);
+		CHECK(calls == 3);
+	}
+	{
+		int a[] = {0, 1, 2, 3};
+		auto rng = subrange{counted_iterator{a, 4}, default_sentinel{}}
+			| view::ext::transform_cached(square{});
+		static_assert(!CommonRange<decltype(rng)>);
+		auto i = begin(rng);
+		++i; ++i;
+		CHECK(*i == 4);
+		CHECK(i != end(rng));
+	}
+
+	return ::test_result();
+}
@@ -0,0 +1,149 @@
+// cmcstl2 - A concept-enabled C++ standard library
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/caseycarter/cmcstl2
+//
+#include <stl2/view/zip.hpp>
+#include <stl2/detail/algorithm/equal.hpp>
+#include <stl2/detail/algorithm/is_sorted.hpp>
+#include <stl2/detail/algorithm/partition.hpp>
+#include <stl2/detail/algorithm/rotate.hpp>
+#include <stl2/detail/algorithm/sort.hpp>
+#include <stl2/view/iota.hpp>
+#include <stl2/view/take_while.hpp>
+#include <forward_list>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "../simple_test.hpp"
+
+namespace ranges = __stl2;
+
+int main() {
+	using namespace ranges;
+
+	{
+		std::vector<int> a = {3, 1, 2};
+		std::string b = "cab";
+		auto rng = view::ext::zip(a, b);
+		using R = decltype(rng);
+		static_assert(View<R>);
+		static_assert(RandomAccessRange<R>);
+		static_assert(CommonRange<R>);
+		static_assert(SizedRange<R>);
+		static_assert(Same<iter_value_t<iterator_t<R>>, std::tuple<int, char>>);
+		static_assert(Same<iter_reference_t<iterator_t<R>>,
+			ext::common_tuple<int&, char&>>);
+		static_assert(Same<iter_rvalue_reference_t<iterator_t<R>>,
+			ext::common_tuple<int&&, char&&>>);
+		static_assert(Sortable<iterator_t<R>>);
+		CHECK(rng.size() == 3u);
+
+		auto [x, y] = *rng.begin();
+		CHECK(x == 3);
+		CHECK(y == 'c');
+		x = 42;
+		CHECK(a[0] == 42);
+		a[0] = 3;
+
+		std::tuple<int, char> t = rng[1];
+		CHECK(t == std::tuple<int, char>{1, 'a'});
+		rng[2] = std::tuple<int, char>{7, 'z'};
+		CHECK(a[2] == 7);
+		CHECK(b[2] == 'z');
+		*rng.begin() = *(rng.begin() + 2);
+		CHECK(a[0] == 7);
+		CHECK(b[0] == 'z');
+	}
+	{
+		// Ranges of different lengths and categories
+		std::vector<int> a = {1, 2, 3, 4, 5};
+		std::forward_list<char> b = {'a', 'b', 'c'};
+		auto rng = view::ext::zip(a, b);
+		using R = decltype(rng);
+		static_assert(ForwardRange<R>);
+		static_assert(!BidirectionalRange<R>);
+		static_assert(CommonRange<R>);
+		int n = 0;
+		for (auto&& [i, c] : rng) {
+			CHECK(i == n + 1);
+			CHECK(c == 'a' + n);
+			++n;
+		}
+		CHECK(n == 3);
+
+		auto counted = subrange{counted_iterator{b.begin(), 2}, default_sentinel{}};
+		auto short_rng = view::ext::zip(a, counted);
+		static_assert(!CommonRange<decltype(short_rng)>);
+		CHECK(ranges::distance(short_rng) == 2);
+
+		const auto crng = view::ext::zip(a, a);
+		static_assert(RandomAccessRange<decltype(crng)>);
+		CHECK(ranges::distance(crng.begin(), crng.end()) == 5);
+	}
+	{
+		// Sort columns together by the first.
+		std::vector<int> keys = {5, 5, 4, 4, 3, 3, 2, 2, 1, 1};
+		std::vector<std::string> names;
+		std::vector<std::unique_ptr<int>> ptrs;
+		for (int i = 0; i < 10; ++i) {
+			names.push_back(std::to_string(i));
+			ptrs.push_back(std::make_unique<int>(i));
+		}
+		auto rng = view::ext::zip(keys, names, ptrs);
+		ranges::sort(rng, less{}, [](auto&& t) -> int { return std::get<0>(t); });
+		CHECK(ranges::is_sorted(keys));
+		for (std::size_t i = 0; i < keys.size(); ++i) {
+			CHECK(keys[i] == 5 - *ptrs[i] / 2);
+			CHECK(names[i] == std::to_string(*ptrs[i]));
+		}
+
+		// Lexicographic by default
+		std::vector<int> v0 = {5, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 2, 2, 1};
+		std::vector<int> v1 = {1, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 5};
+		ranges::sort(view::ext::zip(v0, v1));
+		CHECK_EQUAL(v0, {1, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 5});
+		CHECK_EQUAL(v1, {5, 5, 5, 4, 5, 5, 3, 4, 4, 4, 1, 2, 2, 3, 3});
+	}
+	{
+		std::vector<int> a = {1, 2, 3, 4, 5};
+		std::vector<char> b = {'a', 'b', 'c', 'd', 'e'};
+		auto rng = view::ext::zip(a, b);
+		ranges::rotate(rng, rng.begin() + 2);
+		CHECK_EQUAL(a, {3, 4, 5, 1, 2});
+		CHECK_EQUAL(b, {'c', 'd', 'e', 'a', 'b'});
+
+		ranges::partition(rng, [](auto&& t) { return std::get<0>(t) % 2 == 0; });
+		CHECK((a[0] % 2) == 0);
+		CHECK((a[1] % 2) == 0);
+		CHECK((a[2] % 2) == 1);
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			CHECK(b[i] == 'a' + a[i] - 1);
+		}
+	}
+	{
+		// Agrees with sorting an array of structs.
+		std::mt19937 gen;
+		std::uniform_int_distribution<int> dist{0, 100};
+		std::vector<int> k(5000);
+		std::vector<int> v(5000);
+		std::vector<std::pair<int, int>> aos;
+		for (std::size_t i = 0; i < k.size(); ++i) {
+			k[i] = dist(gen);
+			v[i] = static_cast<int>(i);
+			aos.emplace_back(k[i], v[i]);
+		}
+		ranges::sort(view::ext::zip(k, v));
+		ranges::sort(aos);
+		CHECK(ranges::equal(k, aos, equal_to{}, identity{}, &std::pair<int, int>::first));
+		CHECK(ranges::equal(v, aos, equal_to{}, identity{}, &std::pair<int, int>::second));
+	}
+
+	return ::test_result();
+}